@@ -1 +1,5 @@
+include(CMakeFindDependencyMacro)
+
+find_dependency(Threads)
+
 include(${CMAKE_CURRENT_LIST_DIR}/handy-targets.cmake)
\ No newline at end of file
@@ -0,0 +1,55 @@
+/** 
+  *  \file MultiRangeBenchmark.cpp
+  *  
+  *	Transposing a large matrix with handy::mrange in row major, tiled and
+  * Morton orders. The row major loop writes the output with a stride of a
+  * whole row, missing the cache at almost every element, while the tiled and
+  * Morton loops reuse the lines of both matrices before moving on.
+*/ 
+
+
+#include <iostream>
+#include <vector>
+#include <numeric>
+
+#include "Range/MultiRange.h"
+#include "Range/Parallel.h"
+#include "Helpers/Benchmark.h"
+
+
+using namespace std;
+using namespace handy;
+
+
+
+int main ()
+{
+	const int n = 4096;
+
+	vector<float> a(n * n), b(n * n);
+
+	iota(a.begin(), a.end(), 0.0f);
+
+
+	auto run = [&](const char* name, auto f)
+	{
+		double t = benchmark(f);
+
+		cout << name << t << " s   (" << b[n + 2] << ")\n";
+	};
+
+	run("row major:      ", [&]{ for(auto [i, j] : mrange(n, n)) b[j * n + i] = a[i * n + j]; });
+	run("tiled 32x32:    ", [&]{ for(auto [i, j] : mrange(n, n).tiled(32)) b[j * n + i] = a[i * n + j]; });
+	run("morton:         ", [&]{ for(auto [i, j] : mrange(n, n).morton()) b[j * n + i] = a[i * n + j]; });
+	run("parallel tiles: ", [&]
+	{
+		parallelFor(mrange(n, n).tiled(32).tiles(), [&](auto tile)
+		{
+			for(auto [i, j] : tile)
+				b[j * n + i] = a[i * n + j];
+		});
+	});
+
+
+	return 0;
+}
@@ -0,0 +1,71 @@
+/** 
+  *  \file LoopBenchmark.cpp
+  *  
+  *	A range for over 'zip' of random access containers iterates by a single
+  * index, so it must run as fast as the hand written index loop. Compile with
+  * optimizations (and -O3 or -ftree-vectorize to see the loops vectorized).
+*/ 
+
+
+#include <iostream>
+#include <vector>
+#include <numeric>
+
+#include "ZipIter/ZipIter.h"
+#include "Helpers/Benchmark.h"
+
+
+using namespace std;
+using namespace handy;
+
+
+
+void indexLoop (const vector<float>& x, const vector<float>& y, vector<float>& z)
+{
+	for(size_t i = 0; i < x.size(); ++i)
+		z[i] = 2.0f * x[i] + y[i];
+}
+
+void zipLoop (const vector<float>& x, const vector<float>& y, vector<float>& z)
+{
+	for(auto&& [a, b, c] : zip(x, y, z))
+		c = 2.0f * a + b;
+}
+
+void forEachLoop (const vector<float>& x, const vector<float>& y, vector<float>& z)
+{
+	forEach(x, y, z, [](float a, float b, float& c){ c = 2.0f * a + b; });
+}
+
+void parallelLoop (const vector<float>& x, const vector<float>& y, vector<float>& z)
+{
+	forEach(par, x, y, z, [](float a, float b, float& c){ c = 2.0f * a + b; });
+}
+
+
+
+int main ()
+{
+	const int n = 1 << 20, reps = 200;
+
+	vector<float> x(n), y(n), z(n);
+
+	iota(x.begin(), x.end(), 0.0f);
+	iota(y.begin(), y.end(), 1.0f);
+
+
+	auto run = [&](const char* name, auto f)
+	{
+		double t = benchmark([&]{ for(int r = 0; r < reps; ++r) f(x, y, z); });
+
+		cout << name << t << " s   (" << accumulate(z.begin(), z.end(), 0.0) << ")\n";
+	};
+
+	run("index loop:    ", indexLoop);
+	run("zip range for: ", zipLoop);
+	run("forEach:       ", forEachLoop);
+	run("forEach(par):  ", parallelLoop);
+
+
+	return 0;
+}
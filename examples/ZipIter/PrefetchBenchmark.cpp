@@ -0,0 +1,82 @@
+/** 
+  *  \file PrefetchBenchmark.cpp
+  *  
+  *	Gathering values through an array of random indices, with and without
+  * handy::prefetch, for several prefetch distances. The data is much larger
+  * than the cache, so every access of the plain loop waits for the memory.
+*/ 
+
+
+#include <iostream>
+#include <vector>
+#include <numeric>
+#include <random>
+#include <cstdint>
+
+#include "ZipIter/Prefetch.h"
+#include "Helpers/Benchmark.h"
+
+
+using namespace std;
+using namespace handy;
+
+
+
+/// Some dependent work per element, so the processor can not run far ahead to the next loads
+inline float work (float x)
+{
+	for(int k = 0; k < 3; ++k)
+		x = x * 0.999f + 1.0f;
+
+	return x;
+}
+
+
+void plainLoop (const vector<uint32_t>& idx, const vector<float>& data, vector<float>& out)
+{
+	for(auto&& [i, o] : zip(idx, out))
+		o = work(data[i]);
+}
+
+template <size_t D>
+void prefetchLoop (const vector<uint32_t>& idx, const vector<float>& data, vector<float>& out)
+{
+	auto target = [&](auto&& elem){ return &data[get<0>(elem)]; };
+
+	for(auto&& [i, o] : prefetch<D>(zip(idx, out), target))
+		o = work(data[i]);
+}
+
+
+
+int main ()
+{
+	const int n = 1 << 25;
+
+	mt19937 gen(0);
+
+	vector<float> data(n), out(n);
+	vector<uint32_t> idx(n);
+
+	iota(data.begin(), data.end(), 0.0f);
+
+	for(auto& i : idx)
+		i = uniform_int_distribution<uint32_t>(0, n - 1)(gen);
+
+
+	auto run = [&](const char* name, auto f)
+	{
+		double t = benchmark([&]{ f(idx, data, out); });
+
+		cout << name << t << " s   (" << accumulate(out.begin(), out.end(), 0.0) << ")\n";
+	};
+
+	run("no prefetch:    ", plainLoop);
+	run("prefetch<4>:    ", prefetchLoop<4>);
+	run("prefetch<16>:   ", prefetchLoop<16>);
+	run("prefetch<64>:   ", prefetchLoop<64>);
+	run("prefetch<256>:  ", prefetchLoop<256>);
+
+
+	return 0;
+}
@@ -0,0 +1,104 @@
+/** 
+  *  \file SortBenchmark.cpp
+  *  
+  *	Sorting parallel arrays by a key: std::sort directly over the zipped
+  * arrays against the usual approach of sorting a permutation of indices
+  * and then gathering every array through it, and against handy::sortBy,
+  * which does the latter in parallel.
+*/ 
+
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <numeric>
+#include <algorithm>
+#include <random>
+
+#include "ZipIter/Sort.h"
+#include "Helpers/Benchmark.h"
+
+
+using namespace std;
+using namespace handy;
+
+
+template <class Keys, class Vals>
+void sortZip (Keys& keys, Vals& vals)
+{
+	sort(zipBegin(keys, vals), zipEnd(keys, vals), unZip([](const auto& k1, const auto&, const auto& k2, const auto&)
+	{
+		return k1 < k2;
+	}));
+}
+
+
+template <class Keys, class Vals>
+void sortPermutation (Keys& keys, Vals& vals)
+{
+	vector<size_t> perm(keys.size());
+
+	iota(perm.begin(), perm.end(), 0);
+
+	sort(perm.begin(), perm.end(), [&](size_t i, size_t j){ return keys[i] < keys[j]; });
+
+	Keys sortedKeys(keys.size());
+	Vals sortedVals(vals.size());
+
+	for(size_t i = 0; i < perm.size(); ++i)
+	{
+		sortedKeys[i] = move(keys[perm[i]]);
+		sortedVals[i] = move(vals[perm[i]]);
+	}
+
+	keys = move(sortedKeys);
+	vals = move(sortedVals);
+}
+
+
+template <class Keys, class Vals>
+void run (const string& name, const Keys& keys, const Vals& vals)
+{
+	auto k1 = keys, k2 = keys, k3 = keys;
+	auto v1 = vals, v2 = vals, v3 = vals;
+
+	double zipTime = benchmark([&]{ sortZip(k1, v1); });
+	double permTime = benchmark([&]{ sortPermutation(k2, v2); });
+	double sortByTime = benchmark([&]{ sortBy<0>(zip(k3, v3)); });
+
+	cout << name << "\n"
+		 << "    zip:         " << zipTime << " s\n"
+		 << "    permutation: " << permTime << " s\n"
+		 << "    sortBy:      " << sortByTime << " s\n"
+		 << "    same result: " << boolalpha << (k1 == k2 && k2 == k3) << "\n\n";
+}
+
+
+
+int main ()
+{
+	mt19937 gen(0);
+
+	const int n = 1 << 22;
+
+	vector<int> keys(n);
+	vector<double> vals(n);
+	vector<string> strs(n / 8);
+
+	for(auto& k : keys)
+		k = uniform_int_distribution<>()(gen);
+
+	for(auto& v : vals)
+		v = uniform_real_distribution<>()(gen);
+
+	for(auto& s : strs)
+		s = to_string(uniform_int_distribution<>()(gen)) + " some long enough payload";
+
+
+	run("int keys, double values", keys, vals);
+
+	run("int keys, string values", vector<int>(keys.begin(), keys.begin() + strs.size()), strs);
+
+
+	return 0;
+}
@@ -1,6 +1,6 @@
 function(addExample file_path files)
 
-    foreach(file_name ${files})
+    foreach(file_name ${files} ${ARGN})
 
         get_filename_component(file ${file_name} NAME_WE)
 
@@ -0,0 +1,257 @@
+/** @file
+
+    @brief Parallel fill, transform and reduce over whole containers
+
+    @details These functions take random access containers (a handy::Container, a @c std::vector, ...) and
+             split them into chunks that are processed by the threads of handy::threadPool(). Ex:
+
+    @code{.cpp}
+    handy::Container<double> a(1000, 1000), b(1000, 1000);
+
+    handy::parallelFill(a, 1.0);
+
+    handy::parallelTransform(a, b, [](double x){ return 2 * x; });
+
+    double sum = handy::parallelReduce(b, 0.0);
+    double max = handy::parallelMax(b);
+    @endcode
+
+    @details The chunks have a fixed number of elements (at least 64 KB of data), and when the container
+             exposes @c data(), their boundaries are placed at cache line boundaries, so no two threads ever
+             write to the same cache line.
+
+             The chunks depend only on the size and address of the container, never on the number of
+             threads, and the partial results of handy::parallelReduce() are combined in order. So the
+             result is the same for any number of threads, even for non associative floating point sums.
+*/
+
+#ifndef HANDY_ALGORITHMS_PARALLEL_H
+#define HANDY_ALGORITHMS_PARALLEL_H
+
+#include "../Helpers/Helpers.h"
+#include "../Helpers/Parallel.h"
+
+#include <iterator>
+#include <numeric>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include <cstdint>
+
+
+namespace handy
+{
+
+namespace impl
+{
+
+namespace parallel
+{
+
+/// Size of a cache line, in bytes
+constexpr std::size_t cacheLineSize = 64;
+
+/// Minimum size of a chunk, in bytes
+constexpr std::size_t minChunkBytes = 1 << 16;
+
+
+/// Address of the first element of @p c, or @c nullptr if there is no @c data()
+template <class Cnt>
+const void* address (Cnt& c)
+{
+    if constexpr(HasData<Cnt>::value)
+        return c.data();
+
+    else
+        return nullptr;
+}
+
+
+
+/** @brief Boundaries of the chunks of a range of @p n elements of type @p T
+
+    The first chunk goes from @c 0 up to the first cache aligned element after a whole chunk. All the
+    others start at a cache line boundary, having exactly #size elements (except the last one).
+*/
+template <typename T>
+struct Chunks
+{
+    Chunks (std::size_t n, const void* data) : n(n)
+    {
+        constexpr std::size_t elemsPerLine = sizeof(T) < cacheLineSize && cacheLineSize % sizeof(T) == 0 ?
+                                             cacheLineSize / sizeof(T) : 1;
+
+        size = (std::max<std::size_t>(minChunkBytes / sizeof(T), 1) + elemsPerLine - 1) / elemsPerLine * elemsPerLine;
+
+        if(data && elemsPerLine > 1)
+            head = ((cacheLineSize - std::uintptr_t(data) % cacheLineSize) % cacheLineSize) / sizeof(T) % elemsPerLine;
+    }
+
+
+    /// Number of chunks
+    std::size_t count () const
+    {
+        return n <= head + size ? (n > 0) : 1 + (n - head - 1) / size;
+    }
+
+    /// First element of the chunk @p k. The chunk @p k goes up to <tt>begin(k + 1)</tt>
+    std::size_t begin (std::size_t k) const
+    {
+        return k ? std::min(n, head + k * size) : 0;
+    }
+
+
+    std::size_t n;          ///< Number of elements
+    std::size_t size;       ///< Number of elements of each chunk
+    std::size_t head = 0;   ///< Number of elements before the first cache aligned element
+};
+
+
+
+/// The chunks of the container @p c
+template <class Cnt>
+auto chunks (Cnt& c)
+{
+    return Chunks<std::decay_t<decltype(*std::begin(c))>>(std::distance(std::begin(c), std::end(c)), address(c));
+}
+
+
+/** @brief Calls @p f(k, begin, end) for every chunk @c k, in parallel
+
+    @param chunks The chunks of a container
+    @param f A function taking the index of the chunk and its range of elements
+*/
+template <typename T, class F>
+void forChunks (const Chunks<T>& chunks, F f)
+{
+    threadPool().run(chunks.count(), [&](std::size_t k)
+    {
+        f(k, chunks.begin(k), chunks.begin(k + 1));
+    });
+}
+
+} // namespace parallel
+
+} // namespace impl
+
+
+
+/** @defgroup ParallelAlgorithmsGroup Parallel container algorithms
+    @copydoc Algorithms/Parallel.h
+*/
+
+//@{
+
+/** @brief Assigns @p value to every element of @p c
+    @return @p c
+*/
+template <class Cnt, typename T>
+Cnt&& parallelFill (Cnt&& c, const T& value)
+{
+    auto first = std::begin(c);
+
+    impl::parallel::forChunks(impl::parallel::chunks(c), [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        std::fill(first + begin, first + end, value);
+    });
+
+    return std::forward<Cnt>(c);
+}
+
+
+/** @name
+    @brief Writes @p f applied to the elements of @p in (or of @p in1 and @p in2) into @p out
+
+    @p out must have at least as many elements as the inputs. The chunks are aligned to @p out.
+
+    @return @p out
+*/
+//@{
+template <class In, class Out, class F>
+Out&& parallelTransform (const In& in, Out&& out, F f)
+{
+    auto src = std::begin(in);
+    auto dst = std::begin(out);
+
+    impl::parallel::forChunks(impl::parallel::chunks(out), [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        std::transform(src + begin, src + end, dst + begin, f);
+    });
+
+    return std::forward<Out>(out);
+}
+
+template <class In1, class In2, class Out, class F>
+Out&& parallelTransform (const In1& in1, const In2& in2, Out&& out, F f)
+{
+    auto src1 = std::begin(in1);
+    auto src2 = std::begin(in2);
+    auto dst = std::begin(out);
+
+    impl::parallel::forChunks(impl::parallel::chunks(out), [&](std::size_t, std::size_t begin, std::size_t end)
+    {
+        std::transform(src1 + begin, src1 + end, src2 + begin, dst + begin, f);
+    });
+
+    return std::forward<Out>(out);
+}
+//@}
+
+
+/** @brief Reduces the elements of @p c with the associative operation @p op, starting from @p init
+
+    Each chunk is reduced on its own, and the partial results are then combined in order, from the
+    first to the last chunk. The result is deterministic, not depending on the number of threads.
+
+    @param c The container
+    @param init Initial value. Its type is the type of the result
+    @param op A binary associative operation (a monoid, along with @p init)
+*/
+template <class Cnt, typename T, class Op = std::plus<>>
+T parallelReduce (const Cnt& c, T init, Op op = Op())
+{
+    auto first = std::begin(c);
+
+    auto chunks = impl::parallel::chunks(c);
+
+    std::vector<T> partial(chunks.count());
+
+    impl::parallel::forChunks(chunks, [&](std::size_t k, std::size_t begin, std::size_t end)
+    {
+        partial[k] = std::accumulate(first + begin + 1, first + end, T(first[begin]), op);
+    });
+
+    for(const auto& p : partial)
+        init = op(init, p);
+
+    return init;
+}
+
+
+/** @name
+    @brief Minimum and maximum elements of a non empty container @p c, reduced in parallel
+*/
+//@{
+template <class Cnt>
+auto parallelMin (const Cnt& c)
+{
+    using T = std::decay_t<decltype(*std::begin(c))>;
+
+    return parallelReduce(c, T(*std::begin(c)), [](const T& a, const T& b){ return b < a ? b : a; });
+}
+
+template <class Cnt>
+auto parallelMax (const Cnt& c)
+{
+    using T = std::decay_t<decltype(*std::begin(c))>;
+
+    return parallelReduce(c, T(*std::begin(c)), [](const T& a, const T& b){ return a < b ? b : a; });
+}
+//@}
+
+//@}
+
+} // namespace handy
+
+
+#endif // HANDY_ALGORITHMS_PARALLEL_H
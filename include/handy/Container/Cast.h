@@ -0,0 +1,275 @@
+/** @file
+
+    @brief Element type conversion for handy::Container, with rounding and saturation policies
+
+    handy::cast() creates a new Container of the same shape with the elements converted to another type,
+    and handy::castInto() writes the converted elements into an existing Container (or any contiguous
+    range with the same number of elements). Ex:
+
+    @code{.cpp}
+    handy::Container<std::uint8_t> img(480, 640);
+
+    auto f = handy::cast<float>(img);    // handy::Container<float>(480, 640)
+
+    handy::Container<std::int16_t> pcm(1024);
+    handy::Container<std::int8_t> small(1024);
+
+    handy::castInto<handy::conv::Nearest, handy::conv::Saturate>(handy::cast<double>(pcm), small);
+    @endcode
+
+    The rounding policy is applied only when converting from a floating point to an integral type. The
+    overflow policy handy::conv::Saturate clamps the values to the range of the destination type (NaNs
+    become zero), while handy::conv::Unchecked is a plain @c static_cast.
+
+    The conversion is a plain loop over contiguous memory, with no branches (the clamps are min/max
+    selections), so the compiler can vectorize the widening and narrowing. Large inputs are split
+    between the threads of handy::threadPool().
+*/
+
+#ifndef HANDY_CONTAINER_CAST_H
+#define HANDY_CONTAINER_CAST_H
+
+#include "Container.h"
+#include "../Helpers/Parallel.h"
+
+#include <limits>
+#include <cmath>
+
+
+namespace handy
+{
+
+/// Rounding and overflow policies for handy::cast() and handy::castInto()
+namespace conv
+{
+
+/** @name
+    @brief Rounding policies, applied when converting a floating point to an integral
+*/
+//@{
+/// Rounds towards zero, as the builtin conversion
+struct Truncate
+{
+    template <typename T>
+    static T apply (T x) { return x; }
+};
+
+/// Rounds to the nearest integer, ties to even (in the default floating point environment)
+struct Nearest
+{
+    template <typename T>
+    static T apply (T x) { return std::nearbyint(x); }
+};
+
+/// Rounds towards minus infinity
+struct Floor
+{
+    template <typename T>
+    static T apply (T x) { return std::floor(x); }
+};
+
+/// Rounds towards plus infinity
+struct Ceil
+{
+    template <typename T>
+    static T apply (T x) { return std::ceil(x); }
+};
+//@}
+
+
+/** @name
+    @brief Overflow policies
+*/
+//@{
+/// Simply converts. Values out of the range of the destination type must not happen for floating point sources
+struct Unchecked {};
+
+/// Clamps the values to the range of the destination type
+struct Saturate {};
+//@}
+
+} // namespace conv
+
+
+
+namespace impl
+{
+
+namespace cast
+{
+
+/// Minimum number of elements processed by a single thread
+constexpr std::size_t minBlockSize = 1 << 15;
+
+
+/// @c a @c < @c b for integrals of any signedness, as C++20 std::cmp_less
+template <typename A, typename B>
+constexpr bool less (A a, B b)
+{
+    if constexpr(std::is_signed<A>::value == std::is_signed<B>::value)
+        return a < b;
+
+    else if constexpr(std::is_signed<A>::value)
+        return a < 0 || std::make_unsigned_t<A>(a) < b;
+
+    else
+        return b >= 0 && a < std::make_unsigned_t<B>(b);
+}
+
+
+/** @brief Converts a single element from @p T to @p U
+
+    All the branches are decided at compile time. The remaining ternaries become min/max selections.
+*/
+template <typename U, class Rounding, class Overflow, typename T>
+inline U convert (T x)
+{
+    using LimU = std::numeric_limits<U>;
+
+    if constexpr(std::is_floating_point<T>::value && std::is_integral<U>::value)
+    {
+        x = Rounding::apply(x);
+
+        if constexpr(std::is_same<Overflow, conv::Saturate>::value)
+            return x != x ? U(0) : x <= T(LimU::lowest()) ? LimU::lowest() : x >= T(LimU::max()) ? LimU::max() : U(x);
+
+        else
+            return U(x);
+    }
+
+    else if constexpr(std::is_integral<T>::value && std::is_integral<U>::value &&
+                      std::is_same<Overflow, conv::Saturate>::value)
+    {
+        return less(x, LimU::lowest()) ? LimU::lowest() : less(LimU::max(), x) ? LimU::max() : U(x);
+    }
+
+    else if constexpr(std::is_floating_point<U>::value && std::is_floating_point<T>::value &&
+                      std::is_same<Overflow, conv::Saturate>::value && (sizeof(T) > sizeof(U)))
+    {
+        return x <= T(LimU::lowest()) ? LimU::lowest() : x >= T(LimU::max()) ? LimU::max() : U(x);
+    }
+
+    else
+        return U(x);
+}
+
+
+/// Converts the @p n elements of @p src into @p dst, splitting the work between the threads
+template <class Rounding, class Overflow, typename T, typename U>
+void convert (const T* src, U* dst, std::size_t n)
+{
+    parallel::forBlocks(n, [&](std::size_t begin, std::size_t end)
+    {
+        const T* x = src + begin;
+        U* y = dst + begin;
+
+        for(std::size_t i = 0; i < end - begin; ++i)
+            y[i] = convert<U, Rounding, Overflow>(x[i]);
+
+    }, minBlockSize);
+}
+
+
+/// Converts the elements of @p src into @p dst one by one, by their positions, following the strides of views
+template <class Rounding, class Overflow, class Src, class Dst>
+void convertStrided (const Src& src, Dst& dst)
+{
+    using U = std::remove_reference_t<decltype(*dst.data())>;
+
+    for(std::size_t i = 0; i < src.size(); ++i)
+        dst[i] = convert<U, Rounding, Overflow>(src[i]);
+}
+
+
+/// If the elements of @p c are contiguous, so they can be read through its @c data()
+template <class Cnt>
+bool contiguous (const Cnt& c)
+{
+    if constexpr(MaybeStrided<Cnt>::value)
+        return c.isContiguous();
+
+    else
+        return true;
+}
+
+
+
+/** @name
+    @brief Creates a Container of type @p U with the same shape as @p c
+*/
+//@{
+template <typename U, class Cnt>
+struct Like
+{
+    static handy::Container<U> create (const Cnt& c) { return handy::Container<U>(c.sizes()); }
+};
+
+template <typename U, typename T, std::size_t I, std::size_t... Is>
+struct Like<U, handy::impl::Accessor<handy::impl::Container<T, I, Is...>>>
+{
+    template <class Cnt>
+    static handy::Container<U, I, Is...> create (const Cnt&) { return handy::Container<U, I, Is...>(); }
+};
+//@}
+
+} // namespace cast
+
+} // namespace impl
+
+
+
+/** @ingroup ContainerGroup
+    @copydoc Cast.h
+*/
+//@{
+
+/** @brief Converts the elements of @p src, writing them into @p dst
+
+    @tparam Rounding One of the rounding policies of handy::conv
+    @tparam Overflow One of the overflow policies of handy::conv
+
+    @param src A contiguous Container (or anything exposing @c data() and @c size()), or a handy::ContainerView
+    @param dst A contiguous Container with at least <tt>src.size()</tt> elements, or a handy::ContainerView
+    @return A reference to @p dst
+
+    Views that are not contiguous are converted element by element, following their strides.
+*/
+template <class Rounding = conv::Truncate, class Overflow = conv::Unchecked, class Src, class Dst>
+Dst&& castInto (const Src& src, Dst&& dst)
+{
+    if constexpr(MaybeStrided<Src>::value || MaybeStrided<std::decay_t<Dst>>::value)
+        if(!impl::cast::contiguous(src) || !impl::cast::contiguous(dst))
+        {
+            impl::cast::convertStrided<Rounding, Overflow>(src, dst);
+
+            return std::forward<Dst>(dst);
+        }
+
+    impl::cast::convert<Rounding, Overflow>(src.data(), dst.data(), src.size());
+
+    return std::forward<Dst>(dst);
+}
+
+
+/** @brief Returns a new Container with the same shape as @p c, having the elements converted to @p U
+
+    If @p c has compile time dimensions, so does the result.
+
+    @copydetails castInto()
+*/
+template <typename U, class Rounding = conv::Truncate, class Overflow = conv::Unchecked, class Cnt>
+auto cast (const Cnt& c)
+{
+    auto res = impl::cast::Like<U, Cnt>::create(c);
+
+    castInto<Rounding, Overflow>(c, res);
+
+    return res;
+}
+
+//@}
+
+} // namespace handy
+
+
+#endif // HANDY_CONTAINER_CAST_H
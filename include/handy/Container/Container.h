@@ -297,7 +297,7 @@ public:
     template <typename U>
     const_reference operator () (cnt::IteratorType, const U& begin) const
     {
-        return this->operator[](std::inner_product(weights.begin(), weights.end(), begin, 0));
+        return this->operator[](std::inner_product(weights.begin(), weights.end(), begin, std::size_t(0)));
     }
 
 
@@ -316,14 +316,14 @@ public:
     template <typename U>
     const_reference operator () (std::initializer_list<U> il) const
     {
-        return this->operator[](std::inner_product(weights.begin(), weights.end(), il.begin(), 0));
+        return this->operator[](std::inner_product(weights.begin(), weights.end(), il.begin(), std::size_t(0)));
     }
 
 
 
 
     /// Size of each dimension
-    constexpr std::size_t size (int p) const { return dimSize[p]; }
+    constexpr std::size_t size (std::size_t p) const { return dimSize[p]; }
 
     /// Total size
     constexpr std::size_t size ()      const { return Base::size(); }
@@ -0,0 +1,390 @@
+/** @file
+
+    @brief A non owning handy::Container over external memory
+
+    A handy::ContainerView wraps a pointer and the size of each dimension, exposing the same access
+    operators, slices and iterators of a handy::Container, without copying or owning any data. It
+    is up to you to keep the memory alive while the view is used.
+
+    @code{.cpp}
+    float* buffer = receive();      // 480 * 640 * 3 floats
+
+    handy::ContainerView<float> img(buffer, 480, 640, 3);
+
+    img(10, 20, 2) = 1.0f;
+
+    auto row = img.slice(10);   // 640 x 3 slice of the row 10
+
+    std::sort(img.begin(), img.end());
+    @endcode
+
+    The weights to access each dimension (the strides, in number of elements) can also be given, for
+    example to take a column of a row major matrix. The access operators follow the strides, and a slice
+    is itself a view of the remaining dimensions, with their strides. The iterators are pointers to the
+    memory, so they are only available if the view is contiguous: calling #begin() or #end() on a
+    view that is not throws @c std::logic_error.
+
+    @code{.cpp}
+    handy::ContainerView<float> t(m.data(), {640, 480}, {1, 640});     // Transpose of a 480 x 640 matrix
+
+    auto col = t.slice(10);                 // The column 10 of m, with stride 640
+
+    float x = col(5) + t(10, 6);            // m(5, 10) + m(6, 10)
+    @endcode
+*/
+
+#ifndef HANDY_CONTAINER_CONTAINER_VIEW_H
+#define HANDY_CONTAINER_CONTAINER_VIEW_H
+
+#include "Container.h"
+
+#include <array>
+#include <stdexcept>
+
+
+namespace handy
+{
+
+namespace impl
+{
+
+/** @ingroup ContainerGroup
+    @copydoc ContainerView.h
+*/
+//@{
+
+/** @brief Non owning view of multidimensional data
+
+    @tparam T The type of the elements. Use a @c const type for read only views
+*/
+template <typename T>
+class ContainerView
+{
+public:
+
+
+    /** @name
+        @brief Some type definitions
+    */
+    //@{
+    using value_type = std::remove_const_t<T>;
+
+    using reference = T&;
+
+    using const_reference = const T&;
+
+    using pointer = T*;
+
+    using iterator = T*;
+
+    using const_iterator = const T*;
+    //@}
+
+
+
+
+// --------------------------------- Constructors ---------------------------------------------- //
+
+
+    /// An empty view
+    ContainerView () : ptr(nullptr), numDimensions_(0) {}
+
+
+    /** @brief Constructor taking the size of each dimension as integral types
+
+        @param ptr Pointer to the first element
+        @param args Variadic integral types defining the size of each dimension
+    */
+    template <typename... Args, cnt::EnableIfIntegral< std::decay_t< Args >... > = 0>
+    ContainerView (T* ptr, Args... args) : ptr(ptr), numDimensions_(sizeof...(Args)),
+                                           dimSize{std::size_t(args)...}, weights(sizeof...(Args))
+    {
+        initWeights();
+    }
+
+
+    /** @brief Constructor taking the size of each dimension as an iterable of integrals
+
+        @param ptr Pointer to the first element
+        @param dims Iterable defining the size of each dimension
+    */
+    template <class Dims, cnt::EnableIfIterable< std::decay_t< Dims > > = 0>
+    ContainerView (T* ptr, const Dims& dims) : ptr(ptr), dimSize(std::begin(dims), std::end(dims))
+    {
+        numDimensions_ = dimSize.size();
+
+        weights.resize(numDimensions_);
+
+        initWeights();
+    }
+
+
+    /** @brief Constructor taking the size and the weight (in number of elements) of each dimension
+
+        @param ptr Pointer to the first element
+        @param dims Iterable defining the size of each dimension
+        @param strides Iterable defining the distance between two consecutive elements of each dimension
+    */
+    template <class Dims, class Strides, cnt::EnableIfIterable< std::decay_t< Dims >, std::decay_t< Strides > > = 0>
+    ContainerView (T* ptr, const Dims& dims, const Strides& strides) : ptr(ptr),
+                                                                      dimSize(std::begin(dims), std::end(dims)),
+                                                                      weights(std::begin(strides), std::end(strides))
+    {
+        numDimensions_ = dimSize.size();
+
+        contiguous = isContiguous();
+    }
+
+
+    /// @copydoc ContainerView(T*, const Dims&)
+    ContainerView (T* ptr, std::initializer_list<std::size_t> dims) :
+                   ContainerView(ptr, std::vector<std::size_t>(dims)) {}
+
+    /// @copydoc ContainerView(T*, const Dims&, const Strides&)
+    ContainerView (T* ptr, std::initializer_list<std::size_t> dims, std::initializer_list<std::size_t> strides) :
+                   ContainerView(ptr, std::vector<std::size_t>(dims), std::vector<std::size_t>(strides)) {}
+
+
+    /** @brief A view of a whole Container, with the same dimensions
+
+        @param c A handy::Container. If it is @c const, @p T must also be @c const
+    */
+    template <class Cnt, std::enable_if_t< std::is_convertible< decltype(std::declval<Cnt&>().data()), T* >::value &&
+                                           !std::is_base_of< ContainerView, std::decay_t< Cnt > >::value, int > = 0>
+    ContainerView (Cnt& c) : ptr(c.data()), numDimensions_(c.numDimensions()), weights(c.numDimensions())
+    {
+        for(std::size_t p = 0; p < numDimensions_; ++p)
+            dimSize.push_back(c.size(p));
+
+        initWeights();
+    }
+
+
+
+    /// Row major weights, as in handy::impl::Container::initWeights()
+    void initWeights ()
+    {
+        if(weights.empty())
+            return;
+
+        weights.back() = 1;
+
+        std::partial_sum(dimSize.rbegin() , dimSize.rend() - 1,
+                         weights.rbegin() + 1, std::multiplies<std::size_t>());
+    }
+
+
+
+
+// ------------------------------- Access - operator() --------------------------------------------- //
+
+
+    /// Delegates to handy::impl::Container::increment()
+    template <typename U, typename Iter>
+    static std::size_t increment (const U& u, Iter& iter)
+    {
+        return Container<value_type>::increment(u, iter);
+    }
+
+
+    /** @name
+        @brief Access operators, exactly as the handy::impl::Container ones
+    */
+    //@{
+    template <typename... Args>
+    const_reference operator () (cnt::IntegralType, const Args&... args) const
+    {
+        std::size_t pos = 0;
+
+        auto iter = weights.begin();
+
+        const auto& dummy = { (pos += increment(args, iter), int{})... };
+
+        return ptr[pos];
+    }
+
+    template <typename U>
+    const_reference operator () (cnt::IteratorType, const U& begin) const
+    {
+        return ptr[std::inner_product(weights.begin(), weights.end(), begin, std::size_t(0))];
+    }
+
+    template <typename U>
+    const_reference operator () (std::initializer_list<U> il) const
+    {
+        return ptr[std::inner_product(weights.begin(), weights.end(), il.begin(), std::size_t(0))];
+    }
+    //@}
+
+
+    /// The element at position @p p in row major order, following the strides
+    reference operator [] (std::size_t p) const { return ptr[offset(p)]; }
+
+
+
+    /// Size of each dimension
+    std::size_t size (std::size_t p) const { return dimSize[p]; }
+
+    /// Total number of elements
+    std::size_t size () const
+    {
+        return numDimensions_ ? std::accumulate(dimSize.begin(), dimSize.end(), std::size_t(1),
+                                                std::multiplies<std::size_t>()) : 0;
+    }
+
+    /// Sizes of each dimension
+    auto sizes () const { return dimSize; }
+
+    /// Weights of each dimension, in number of elements
+    auto strides () const { return weights; }
+
+    /// Number of dimensions
+    std::size_t numDimensions () const { return numDimensions_; }
+
+
+    /// If the elements are contiguous and in row major order, so the iterators traverse all of them
+    bool isContiguous () const
+    {
+        std::size_t w = 1;
+
+        for(std::size_t p = numDimensions_; p-- > 0; w *= dimSize[p])
+            if(weights[p] != w && dimSize[p] != 1)
+                return false;
+
+        return true;
+    }
+
+
+    /// Pointer to the first element. The others are at the positions given by #strides()
+    T* data () const { return ptr; }
+
+
+    /** @name
+        @brief Iterators over the contiguous memory. Throw @c std::logic_error if the view is not contiguous
+    */
+    //@{
+    iterator begin () const { return contiguousData(); }
+
+    iterator end () const { return contiguousData() + size(); }
+
+    const_iterator cbegin () const { return contiguousData(); }
+
+    const_iterator cend () const { return contiguousData() + size(); }
+    //@}
+
+
+
+
+//---------------------------------- Slice ---------------------------------------------- //
+
+
+    /** @brief Takes a slice of the view, fixing the first dimensions to the positions @p args
+
+        The slice is a view of the remaining dimensions, keeping their strides.
+
+        @param args Integrals, a single iterable of integrals or an initializer list
+    */
+    template <typename... Args, cnt::EnableIfIntegral< std::decay_t< Args >... > = 0>
+    auto slice (const Args&... args) const
+    {
+        std::array<std::size_t, sizeof...(Args)> fixed = { std::size_t(args)... };
+
+        return subView(fixed.begin(), fixed.end());
+    }
+
+    /// @copydoc slice()
+    template <class Idx, cnt::EnableIfIterable< std::decay_t< Idx > > = 0>
+    auto slice (const Idx& idx) const
+    {
+        return subView(std::begin(idx), std::end(idx));
+    }
+
+    /// @copydoc slice()
+    auto slice (std::initializer_list<std::size_t> il) const
+    {
+        return subView(il.begin(), il.end());
+    }
+
+
+
+private:
+
+    /// Position in memory of the element @p pos in row major order
+    std::size_t offset (std::size_t pos) const
+    {
+        if(contiguous)
+            return pos;
+
+        std::size_t res = 0;
+
+        for(std::size_t p = numDimensions_; p-- > 0; pos /= dimSize[p])
+            res += (pos % dimSize[p]) * weights[p];
+
+        return res;
+    }
+
+    /// The pointer to the memory, if the elements are contiguous
+    T* contiguousData () const
+    {
+        if(!contiguous)
+            throw std::logic_error("handy::ContainerView: iterators need contiguous elements");
+
+        return ptr;
+    }
+
+    /// View of the dimensions after the positions <tt>[first, last)</tt>, fixed
+    template <class Iter>
+    auto subView (Iter first, Iter last) const
+    {
+        std::size_t k = std::distance(first, last);
+
+        return Accessor<ContainerView>(ptr + std::inner_product(first, last, weights.begin(), std::size_t(0)),
+                                       std::vector<std::size_t>(dimSize.begin() + k, dimSize.end()),
+                                       std::vector<std::size_t>(weights.begin() + k, weights.end()));
+    }
+
+
+    T* ptr;     ///< The external memory
+
+    std::size_t numDimensions_;         ///< Number of dimensions
+
+    std::vector<std::size_t> dimSize;   ///< The size of each dimension
+
+    std::vector<std::size_t> weights;   ///< The weights to access given the position and sizes of the dimensions
+
+    bool contiguous = true;             ///< If the elements are contiguous and in row major order
+};
+//@}
+
+} // namespace impl
+
+
+
+/// An alias defining an accessor to ContainerView
+template <typename T>
+using ContainerView = handy::impl::Accessor<handy::impl::ContainerView<T>>;
+
+
+/** @brief Creates a handy::ContainerView, deducing the type of the elements from the pointer
+
+    @param ptr Pointer to the first element
+    @param args The size of each dimension, either integrals or a single iterable
+*/
+template <typename T, typename... Args>
+ContainerView<T> view (T* ptr, Args&&... args)
+{
+    return ContainerView<T>(ptr, std::forward<Args>(args)...);
+}
+
+/// A handy::ContainerView of the whole Container @p c
+template <class Cnt, std::enable_if_t<!std::is_pointer<std::decay_t<Cnt>>::value, int> = 0>
+auto view (Cnt& c)
+{
+    return ContainerView<std::remove_pointer_t<decltype(c.data())>>(c);
+}
+
+
+} // namespace handy
+
+
+#endif // HANDY_CONTAINER_CONTAINER_VIEW_H
@@ -137,7 +137,7 @@ using EnableIfIntegralOrIterable = std::enable_if_t<And_v<(std::is_integral_v<Ar
 
 /** @name 
 	@brief These are dummy classes that help to create functions to treat the type of parameters 
- 		   of the accessors: integrals, iterables or iterators.
+ 		   of the accessors: integrals, iterables, iterators or raw ranges of the contiguous array.
 */
 //@{
 struct IntegralType {};
@@ -145,6 +145,8 @@ struct IntegralType {};
 struct IterableType {};
 
 struct IteratorType {};
+
+struct RangeType {};
 //@}
 
 } // namespace cnt
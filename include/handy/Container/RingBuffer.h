@@ -0,0 +1,277 @@
+/** @file
+
+    @brief A handy::Container whose first dimension is a fixed capacity circular buffer
+
+    Useful for streaming data, like time series, where only the last @c N rows are of interest. Pushing
+    a new row overwrites the oldest one when the buffer is full, costing only the copy of that row.
+
+    The access operators and handy::impl::RingBuffer::slice() take the logical position of the row, that is,
+    @c 0 is always the oldest row and <tt>rows() - 1</tt> is the newest one.
+
+    @code{.cpp}
+    handy::RingBuffer<double> rb(100, 3);   // Up to 100 rows of 3 elements
+
+    rb.push_back(std::vector<double>{1.0, 2.0, 3.0});
+
+    double x = rb(0, 2);    // Last element of the oldest row
+
+    auto [first, second] = rb.window();   // Current window as at most two contiguous slices
+    @endcode
+*/
+
+#ifndef HANDY_CONTAINER_RING_BUFFER_H
+#define HANDY_CONTAINER_RING_BUFFER_H
+
+#include "Container.h"
+
+
+namespace handy
+{
+
+namespace impl
+{
+
+/** @ingroup ContainerGroup
+    @copydoc RingBuffer.h
+*/
+//@{
+
+/** @brief Class that turns the first dimension of a handy::impl::Container into a circular buffer
+
+    @tparam T The Container's type
+    @tparam Is The compile time size of each dimension. The first one is the capacity of the buffer
+
+    The constructors are the same as the ones from handy::impl::Container. The begin and end iterators
+    traverse the raw storage, so the rows are in physical order. Use #window() to get the logical order.
+*/
+template <typename T, std::size_t... Is>
+class RingBuffer : public Container<T, Is...>
+{
+public:
+
+    /** @name
+        @brief Some type definitions
+    */
+    //@{
+    using Base = Container<T, Is...>;
+
+    using Base::Base;
+
+
+    using value_type = typename Base::value_type;
+
+    using reference = typename Base::reference;
+
+    using const_reference = typename Base::const_reference;
+
+
+    /// A slice of the underlying Container
+    using slice_type = Accessor<Slice<Base>>;
+
+    /// A const slice of the underlying Container
+    using const_slice_type = Accessor<Slice<const Base>>;
+    //@}
+
+
+
+
+// ------------------------------- Access - operator() --------------------------------------------- //
+
+
+    /** @name
+        @brief Access operators taking the logical position of the rows
+
+        They are the same as the handy::impl::Container ones, but the resulting position is shifted
+        by the position of the oldest row, wrapping around the end of the storage.
+    */
+    //@{
+    template <typename... Args>
+    const_reference operator () (cnt::IntegralType, const Args&... args) const
+    {
+        std::size_t pos = 0;
+
+        auto iter = this->weights.begin();
+
+        const auto& dummy = { (pos += Base::increment(args, iter), int{})... };
+
+        return this->operator[](physical(pos));
+    }
+
+    template <typename U>
+    const_reference operator () (cnt::IteratorType, const U& begin) const
+    {
+        return this->operator[](physical(std::inner_product(this->weights.begin(), this->weights.end(),
+                                                            begin, std::size_t(0))));
+    }
+
+    template <typename U>
+    const_reference operator () (std::initializer_list<U> il) const
+    {
+        return this->operator[](physical(std::inner_product(this->weights.begin(), this->weights.end(),
+                                                            il.begin(), std::size_t(0))));
+    }
+    //@}
+
+
+
+
+// ------------------------------------ Insertion ------------------------------------------------ //
+
+
+    /** @brief Inserts a new row at the end of the window
+
+        If the buffer is full, the oldest row is overwritten. No element other than the ones of
+        the new row is touched.
+
+        @param row An iterable with exactly <tt>rowSize()</tt> elements
+    */
+    template <class Row, cnt::EnableIfIterable<std::decay_t<Row>> = 0>
+    void push_back (const Row& row)
+    {
+        std::copy(std::begin(row), std::end(row), this->begin() + nextRow() * rowSize());
+    }
+
+    /// @copybrief push_back() For the case where each row has a single element
+    void push_back (const value_type& value)
+    {
+        this->operator[](nextRow() * rowSize()) = value;
+    }
+
+
+    /// Empties the window. The storage is untouched.
+    void clear ()
+    {
+        head = count = 0;
+    }
+
+
+
+
+//---------------------------------- Slice ---------------------------------------------- //
+
+
+    /** @brief Takes a slice starting at the logical row @p row
+
+        As a row is never split in the storage, the slice is always contiguous.
+
+        @param row Logical row of the slice
+        @param args Variadic integral arguments defining the other dimensions to 'take a slice'.
+    */
+    template <typename... Args, cnt::EnableIfIntegral<std::decay_t<Args>...> = 0>
+    auto slice (std::size_t row, const Args&... args) const
+    {
+        return Base::slice(physicalRow(row), args...);
+    }
+
+    /// @copydoc slice()
+    template <typename... Args, cnt::EnableIfIntegral<std::decay_t<Args>...> = 0>
+    auto slice (std::size_t row, const Args&... args)
+    {
+        return Base::slice(physicalRow(row), args...);
+    }
+
+
+    /** @brief The current window as at most two contiguous slices, in logical order
+
+        The first slice starts at the oldest row. If the window wraps around the end of the storage,
+        the second slice starts at the beginning of the storage. Otherwise it is empty.
+
+        @note The slices have no fixed dimension, so they are accessed with all the dimensions of the buffer.
+    */
+    std::pair<const_slice_type, const_slice_type> window () const
+    {
+        return window<const_slice_type>(static_cast<const Base&>(*this));
+    }
+
+    /// @copydoc window()
+    std::pair<slice_type, slice_type> window ()
+    {
+        return window<slice_type>(static_cast<Base&>(*this));
+    }
+
+
+
+
+    /// Number of rows currently in the window
+    std::size_t rows () const { return count; }
+
+    /// Maximum number of rows
+    std::size_t capacity () const { return this->dimSize[0]; }
+
+    /// Number of elements of a single row
+    std::size_t rowSize () const { return this->weights[0]; }
+
+    /// If there is no row in the window
+    bool empty () const { return count == 0; }
+
+    /// If the next insertion will overwrite the oldest row
+    bool full () const { return count == capacity(); }
+
+
+
+private:
+
+
+    /// Converts a logical position in the contiguous array to the physical one
+    std::size_t physical (std::size_t pos) const
+    {
+        pos += head * rowSize();
+
+        return pos >= this->size() ? pos - this->size() : pos;
+    }
+
+    /// Converts a logical row to the physical one
+    std::size_t physicalRow (std::size_t row) const
+    {
+        row += head;
+
+        return row >= capacity() ? row - capacity() : row;
+    }
+
+
+    /// Physical row where the next insertion goes, updating the window
+    std::size_t nextRow ()
+    {
+        if(count < capacity())
+            return physicalRow(count++);
+
+        std::size_t row = head;
+
+        head = physicalRow(1);
+
+        return row;
+    }
+
+
+    /// Creates the slices for #window()
+    template <class SliceType, class Cnt>
+    std::pair<SliceType, SliceType> window (Cnt& c) const
+    {
+        std::size_t last = head + count;
+        std::size_t wrap = last > capacity() ? last - capacity() : 0;
+
+        return { SliceType(c, cnt::RangeType{}, head * rowSize(), (last - wrap) * rowSize()),
+                 SliceType(c, cnt::RangeType{}, 0, wrap * rowSize()) };
+    }
+
+
+
+    std::size_t head = 0;      ///< Physical row of the oldest element
+    std::size_t count = 0;     ///< Number of rows in the window
+
+};
+//@}
+
+} // namespace impl
+
+
+
+/// An alias defining an accessor to RingBuffer
+template <typename T, std::size_t... Is>
+using RingBuffer = handy::impl::Accessor<handy::impl::RingBuffer<T, Is...>>;
+
+
+} // namespace handy
+
+
+#endif // HANDY_CONTAINER_RING_BUFFER_H
@@ -80,7 +80,7 @@ public:
     {
         auto iter = c.weights.begin();
 
-        const auto& dummy = { (first += std::inner_product(args.begin(), args.end(), iter, 0), 
+        const auto& dummy = { (first += std::inner_product(args.begin(), args.end(), iter, std::size_t(0)), 
                                                             iter += args.size())... };
         dims = iter - c.weights.begin();
 
@@ -92,7 +92,7 @@ public:
     template <typename U, typename V, handy::impl::cnt::EnableIfIterator< std::decay_t< U >, std::decay_t< V > > = 0>
     Slice (Cnt& c, const U& begin, const V& end) : c(c), dims(std::distance(begin, end)), first(0)
     {
-        first = std::inner_product(begin, end, c.weights.begin(), 0);
+        first = std::inner_product(begin, end, c.weights.begin(), std::size_t(0));
 
         last = first + c.weights[dims-1];
     }
@@ -101,6 +101,15 @@ public:
     /// For list initialization
     template <typename U, handy::impl::cnt::EnableIfIntegral<std::decay_t<U>> = 0> 
     Slice (Cnt& c, std::initializer_list<U> il) : Slice(c, il.begin(), il.end()) {}
+
+
+    /** @brief For a raw range <tt>[first, last)</tt> of the contiguous array
+        
+        No dimension is fixed, so the access is made with all the dimensions of the Container, starting at
+        @p first. The range is expected to span whole blocks of the first dimension.
+    */
+    Slice (Cnt& c, handy::impl::cnt::RangeType, std::size_t first, std::size_t last) : c(c), dims(0), 
+                                                                                       first(first), last(last) {}
     //@}
 
 
@@ -134,7 +143,7 @@ public:
     template <typename U, handy::impl::cnt::EnableIfIterator< std::decay_t< U >> = 0>
     const_reference operator () (handy::impl::cnt::IteratorType, const U& begin) const
     {
-        return this->operator[](std::inner_product(c.weights.begin() + dims, c.weights.end(), begin(), first));
+        return c[std::inner_product(c.weights.begin() + dims, c.weights.end(), begin, first)];
     }
 
 
@@ -142,20 +151,20 @@ public:
     template <typename U>
     const_reference operator () (std::initializer_list<U> il) const
     {
-        return this->operator[](std::inner_product(c.weights.begin() + dims, c.weights.end(), il.begin(), 0));
+        return c[std::inner_product(c.weights.begin() + dims, c.weights.end(), il.begin(), first)];
     }
 
 
 
 
     /// Overloading the access via operator[]
-    const_reference operator [] (int p) const
+    const_reference operator [] (std::size_t p) const
     {
         return c[first + p];
     }
 
     /// @copydoc operator[]()
-    reference operator [] (int p)
+    reference operator [] (std::size_t p)
     {
         return const_cast<reference>(static_cast<const Slice&>(*this)[p]);
     }
@@ -163,7 +172,7 @@ public:
 
 
     /// Size of each dimension
-    auto size (int p) const { return c.size(dims + p); }
+    auto size (std::size_t p) const { return c.size(dims + p); }
 
     /// Total size of the slice
     auto size () const      { return last - first; }
@@ -187,9 +196,9 @@ private:
 
     Cnt& c;             ///< Reference to the creator container
 
-    int dims;           ///< Number of dimensions BEFORE the slice
-    int first;          ///< First element on the contiguous array
-    int last;           ///< Last element on the contiguous array
+    std::size_t dims;           ///< Number of dimensions BEFORE the slice
+    std::size_t first;          ///< First element on the contiguous array
+    std::size_t last;           ///< Last element on the contiguous array
 
 };
 //@}
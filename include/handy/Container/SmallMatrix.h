@@ -0,0 +1,323 @@
+/** @file
+
+    @brief Fully unrolled operations over small matrices with compile time size
+
+    Multiplication, transposition, determinant, inverse and dot product for a handy::Container<T, R, C>
+    (or for a @c std::array holding a row major matrix). Every element of the result is written as a
+    single expression, expanded at compile time from the sizes of the matrices, so there is no loop and
+    no branch left for the compiler to deal with.
+
+    The @c std::array versions are @c constexpr, so they can also be evaluated at compile time:
+
+    @code{.cpp}
+    constexpr std::array<int, 4> a = {1, 2, 3, 4};
+
+    static_assert(handy::determinant<2>(a) == -2, "");
+
+    handy::Container<double, 3, 3> m;
+
+    auto inv = handy::inverse(m);           // handy::Container<double, 3, 3>
+    auto mt = handy::multiply(m, handy::transpose(m));
+    @endcode
+
+    @note The determinant and inverse are defined for matrices up to 4x4. The inverse does no pivoting
+          and does not check for singular matrices.
+*/
+
+#ifndef HANDY_CONTAINER_SMALL_MATRIX_H
+#define HANDY_CONTAINER_SMALL_MATRIX_H
+
+#include "Container.h"
+
+#include <array>
+#include <utility>
+
+
+namespace handy
+{
+
+namespace impl
+{
+
+namespace mat
+{
+
+/** @name
+    @brief Element @p E of the product between the @p R x @p K matrix @p a and the @p K x @p C matrix @p b
+*/
+//@{
+template <std::size_t E, std::size_t K, std::size_t C, class A, class B, std::size_t... Ks>
+constexpr auto multiplyAt (const A& a, const B& b, std::index_sequence<Ks...>)
+{
+    return ((a[(E / C) * K + Ks] * b[Ks * C + E % C]) + ...);
+}
+
+template <std::size_t R, std::size_t K, std::size_t C, class Result, class A, class B, std::size_t... Es>
+constexpr Result multiply (const A& a, const B& b, std::index_sequence<Es...>)
+{
+    return Result{ typename Result::value_type(multiplyAt<Es, K, C>(a, b, std::make_index_sequence<K>()))... };
+}
+//@}
+
+
+/// Transpose of the @p R x @p C matrix @p a
+template <std::size_t R, std::size_t C, class Result, class A, std::size_t... Es>
+constexpr Result transpose (const A& a, std::index_sequence<Es...>)
+{
+    return Result{ a[(Es % R) * C + Es / R]... };
+}
+
+
+/// Dot product between @p a and @p b
+template <class A, class B, std::size_t... Is>
+constexpr auto dot (const A& a, const B& b, std::index_sequence<Is...>)
+{
+    return ((a[Is] * b[Is]) + ...);
+}
+
+
+
+/** @brief Determinant and inverse of a @p N x @p N matrix, written in closed form for each @p N
+
+    The inverse is the adjugate matrix divided by the determinant.
+*/
+template <std::size_t N>
+struct Square;
+
+/// @copydoc Square
+template <>
+struct Square<1>
+{
+    template <class A>
+    static constexpr auto determinant (const A& a)
+    {
+        return a[0];
+    }
+
+    template <class Result, class A>
+    static constexpr Result inverse (const A& a)
+    {
+        return Result{ decltype(a[0] + a[0])(1) / a[0] };
+    }
+};
+
+/// @copydoc Square
+template <>
+struct Square<2>
+{
+    template <class A>
+    static constexpr auto determinant (const A& a)
+    {
+        return a[0] * a[3] - a[1] * a[2];
+    }
+
+    template <class Result, class A>
+    static constexpr Result inverse (const A& a)
+    {
+        auto inv = decltype(a[0] + a[0])(1) / determinant(a);
+
+        return Result{ a[3] * inv, -a[1] * inv,
+                      -a[2] * inv,  a[0] * inv };
+    }
+};
+
+/// @copydoc Square
+template <>
+struct Square<3>
+{
+    template <class A>
+    static constexpr auto determinant (const A& a)
+    {
+        return a[0] * (a[4] * a[8] - a[5] * a[7]) +
+               a[1] * (a[5] * a[6] - a[3] * a[8]) +
+               a[2] * (a[3] * a[7] - a[4] * a[6]);
+    }
+
+    template <class Result, class A>
+    static constexpr Result inverse (const A& a)
+    {
+        auto c0 = a[4] * a[8] - a[5] * a[7];
+        auto c3 = a[5] * a[6] - a[3] * a[8];
+        auto c6 = a[3] * a[7] - a[4] * a[6];
+
+        auto inv = decltype(a[0] + a[0])(1) / (a[0] * c0 + a[1] * c3 + a[2] * c6);
+
+        return Result{ c0 * inv, (a[2] * a[7] - a[1] * a[8]) * inv, (a[1] * a[5] - a[2] * a[4]) * inv,
+                       c3 * inv, (a[0] * a[8] - a[2] * a[6]) * inv, (a[2] * a[3] - a[0] * a[5]) * inv,
+                       c6 * inv, (a[1] * a[6] - a[0] * a[7]) * inv, (a[0] * a[4] - a[1] * a[3]) * inv };
+    }
+};
+
+/** @copydoc Square
+
+    The 2x2 minors of the first two rows (@c s) and of the last two rows (@c c) are shared between the
+    determinant and all the cofactors.
+*/
+template <>
+struct Square<4>
+{
+    template <class A>
+    static constexpr auto minors (const A& a)
+    {
+        using T = decltype(a[0] * a[0]);
+
+        return std::array<T, 12>{ a[0] * a[5] - a[4] * a[1],   a[0] * a[6] - a[4] * a[2],
+                                  a[0] * a[7] - a[4] * a[3],   a[1] * a[6] - a[5] * a[2],
+                                  a[1] * a[7] - a[5] * a[3],   a[2] * a[7] - a[6] * a[3],
+                                  a[8] * a[13] - a[12] * a[9], a[8] * a[14] - a[12] * a[10],
+                                  a[8] * a[15] - a[12] * a[11], a[9] * a[14] - a[13] * a[10],
+                                  a[9] * a[15] - a[13] * a[11], a[10] * a[15] - a[14] * a[11] };
+    }
+
+    template <class M>
+    static constexpr auto determinant (const M& m, int)
+    {
+        return m[0] * m[11] - m[1] * m[10] + m[2] * m[9] + m[3] * m[8] - m[4] * m[7] + m[5] * m[6];
+    }
+
+    template <class A>
+    static constexpr auto determinant (const A& a)
+    {
+        return determinant(minors(a), 0);
+    }
+
+    template <class Result, class A>
+    static constexpr Result inverse (const A& a)
+    {
+        const auto m = minors(a);
+
+        const auto& s0 = m[0]; const auto& s1 = m[1]; const auto& s2 = m[2];
+        const auto& s3 = m[3]; const auto& s4 = m[4]; const auto& s5 = m[5];
+        const auto& c0 = m[6]; const auto& c1 = m[7]; const auto& c2 = m[8];
+        const auto& c3 = m[9]; const auto& c4 = m[10]; const auto& c5 = m[11];
+
+        auto inv = decltype(a[0] + a[0])(1) / determinant(m, 0);
+
+        return Result{ ( a[5] * c5 - a[6] * c4 + a[7] * c3) * inv,
+                       (-a[1] * c5 + a[2] * c4 - a[3] * c3) * inv,
+                       ( a[13] * s5 - a[14] * s4 + a[15] * s3) * inv,
+                       (-a[9] * s5 + a[10] * s4 - a[11] * s3) * inv,
+
+                       (-a[4] * c5 + a[6] * c2 - a[7] * c1) * inv,
+                       ( a[0] * c5 - a[2] * c2 + a[3] * c1) * inv,
+                       (-a[12] * s5 + a[14] * s2 - a[15] * s1) * inv,
+                       ( a[8] * s5 - a[10] * s2 + a[11] * s1) * inv,
+
+                       ( a[4] * c4 - a[5] * c2 + a[7] * c0) * inv,
+                       (-a[0] * c4 + a[1] * c2 - a[3] * c0) * inv,
+                       ( a[12] * s4 - a[13] * s2 + a[15] * s0) * inv,
+                       (-a[8] * s4 + a[9] * s2 - a[11] * s0) * inv,
+
+                       (-a[4] * c3 + a[5] * c1 - a[6] * c0) * inv,
+                       ( a[0] * c3 - a[1] * c1 + a[2] * c0) * inv,
+                       (-a[12] * s3 + a[13] * s1 - a[14] * s0) * inv,
+                       ( a[8] * s3 - a[9] * s1 + a[10] * s0) * inv };
+    }
+};
+
+} // namespace mat
+
+} // namespace impl
+
+
+
+/** @ingroup ContainerGroup
+    @copydoc SmallMatrix.h
+*/
+//@{
+
+/** @name
+    @brief Product between a @p R x @p K and a @p K x @p C matrix
+*/
+//@{
+template <typename T, std::size_t R, std::size_t K, std::size_t C>
+Container<T, R, C> multiply (const Container<T, R, K>& a, const Container<T, K, C>& b)
+{
+    return impl::mat::multiply<R, K, C, Container<T, R, C>>(a, b, std::make_index_sequence<R * C>());
+}
+
+template <std::size_t R, std::size_t K, std::size_t C, typename T>
+constexpr std::array<T, R * C> multiply (const std::array<T, R * K>& a, const std::array<T, K * C>& b)
+{
+    return impl::mat::multiply<R, K, C, std::array<T, R * C>>(a, b, std::make_index_sequence<R * C>());
+}
+//@}
+
+
+/** @name
+    @brief Transpose of a @p R x @p C matrix
+*/
+//@{
+template <typename T, std::size_t R, std::size_t C>
+Container<T, C, R> transpose (const Container<T, R, C>& a)
+{
+    return impl::mat::transpose<R, C, Container<T, C, R>>(a, std::make_index_sequence<R * C>());
+}
+
+template <std::size_t R, std::size_t C, typename T>
+constexpr std::array<T, R * C> transpose (const std::array<T, R * C>& a)
+{
+    return impl::mat::transpose<R, C, std::array<T, R * C>>(a, std::make_index_sequence<R * C>());
+}
+//@}
+
+
+/** @name
+    @brief Dot product between two Containers (or arrays) of the same shape
+*/
+//@{
+template <typename T, std::size_t I, std::size_t... Is>
+T dot (const Container<T, I, Is...>& a, const Container<T, I, Is...>& b)
+{
+    return impl::mat::dot(a, b, std::make_index_sequence<impl::cnt::multiply_v<I, Is...>>());
+}
+
+template <typename T, std::size_t N>
+constexpr T dot (const std::array<T, N>& a, const std::array<T, N>& b)
+{
+    return impl::mat::dot(a, b, std::make_index_sequence<N>());
+}
+//@}
+
+
+/** @name
+    @brief Determinant of a @p N x @p N matrix
+*/
+//@{
+template <typename T, std::size_t N>
+T determinant (const Container<T, N, N>& a)
+{
+    return impl::mat::Square<N>::determinant(a);
+}
+
+template <std::size_t N, typename T>
+constexpr T determinant (const std::array<T, N * N>& a)
+{
+    return impl::mat::Square<N>::determinant(a);
+}
+//@}
+
+
+/** @name
+    @brief Inverse of a @p N x @p N matrix
+*/
+//@{
+template <typename T, std::size_t N>
+Container<T, N, N> inverse (const Container<T, N, N>& a)
+{
+    return impl::mat::Square<N>::template inverse<Container<T, N, N>>(a);
+}
+
+template <std::size_t N, typename T>
+constexpr std::array<T, N * N> inverse (const std::array<T, N * N>& a)
+{
+    return impl::mat::Square<N>::template inverse<std::array<T, N * N>>(a);
+}
+//@}
+
+//@}
+
+} // namespace handy
+
+
+#endif // HANDY_CONTAINER_SMALL_MATRIX_H
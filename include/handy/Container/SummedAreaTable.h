@@ -0,0 +1,439 @@
+/** @file
+
+    @brief N-dimensional summed area tables (prefix sums) over a handy::Container
+
+    After building the table, the sum of any box of the Container is given by the inclusion-exclusion of
+    @f$ 2^d @f$ elements of the table, where @c d is the number of dimensions.
+
+    The table has one extra element at the start of each dimension, filled with zeros, so no query needs
+    to test for the borders. It is built by an inclusive scan along each dimension, in parallel and always
+    running the innermost loop over contiguous memory.
+
+    @code{.cpp}
+    handy::Container<std::uint8_t> img(480, 640);
+
+    handy::SummedAreaTable sat(img);    // Accumulates in 'unsigned long long'
+
+    auto s = sat.sum({10, 20}, {50, 100});     // Sum of img(i, j) for 10 <= i < 50 and 20 <= j < 100
+
+    img(30, 40) = 7;
+
+    sat.update(img, {30, 40}, {31, 41});    // Only the elements after (30, 40) are recomputed
+    @endcode
+*/
+
+#ifndef HANDY_CONTAINER_SUMMED_AREA_TABLE_H
+#define HANDY_CONTAINER_SUMMED_AREA_TABLE_H
+
+#include "Container.h"
+#include "../Helpers/Parallel.h"
+
+#include <vector>
+#include <iterator>
+
+
+namespace handy
+{
+
+namespace impl
+{
+
+namespace sat
+{
+
+/// Minimum number of elements processed by a single thread
+constexpr std::size_t minBlockSize = 1 << 14;
+
+
+/** @name
+    @brief The type used to accumulate elements of type @p T, to avoid overflows in large regions
+*/
+//@{
+template <typename T, typename = void>
+struct Accumulator { using type = T; };
+
+template <typename T>
+struct Accumulator<T, std::enable_if_t<std::is_integral<T>::value>>
+{
+    using type = std::conditional_t<std::is_signed<T>::value, long long, unsigned long long>;
+};
+
+template <typename T>
+struct Accumulator<T, std::enable_if_t<std::is_floating_point<T>::value>>
+{
+    using type = std::common_type_t<T, double>;
+};
+//@}
+
+
+
+/// Product of the elements of @p dims in the range <tt>[first, last)</tt>
+inline std::size_t product (const std::vector<std::size_t>& dims, std::size_t first, std::size_t last)
+{
+    return std::accumulate(dims.begin() + first, dims.begin() + last, std::size_t(1), std::multiplies<std::size_t>());
+}
+
+/// Row major weights of an array with dimensions @p dims
+inline std::vector<std::size_t> strides (const std::vector<std::size_t>& dims)
+{
+    std::vector<std::size_t> res(dims.size());
+
+    for(std::size_t p = 0; p < dims.size(); ++p)
+        res[p] = product(dims, p + 1, dims.size());
+
+    return res;
+}
+
+
+/// Strides of the elements of @p c: its own, if they may not be row major, or the row major ones of its @p dims
+template <class Cnt>
+std::vector<std::size_t> strides (const Cnt& c, const std::vector<std::size_t>& dims)
+{
+    if constexpr(MaybeStrided<Cnt>::value)
+        return c.strides();
+
+    else
+        return strides(dims);
+}
+
+
+
+/** @brief Inclusive scan along the dimension @p axis of a dense row major array
+
+    If @p inverse is true, the adjacent difference (the inverse of the scan) is taken instead. Every
+    column along @p axis is independent, so they are split between the threads. The innermost loop
+    goes over the contiguous elements of the next dimensions, so it is easily vectorized.
+*/
+template <typename T>
+void scanAxis (T* data, const std::vector<std::size_t>& dims, std::size_t axis, bool inverse = false)
+{
+    std::size_t n = dims[axis];
+    std::size_t w = product(dims, axis + 1, dims.size());
+    std::size_t columns = product(dims, 0, axis) * w;
+
+    if(n < 2 || columns == 0)
+        return;
+
+
+    parallel::forBlocks(columns, [&](std::size_t begin, std::size_t end)
+    {
+        for(std::size_t c = begin; c < end; )
+        {
+            std::size_t j = c % w;
+            std::size_t k = std::min(w, j + (end - c));
+
+            T* base = data + (c / w) * n * w;
+
+            if(!inverse)
+            {
+                for(std::size_t i = 1; i < n; ++i)
+                {
+                    T* cur = base + i * w;
+                    const T* prev = cur - w;
+
+                    for(std::size_t l = j; l < k; ++l)
+                        cur[l] += prev[l];
+                }
+            }
+
+            else
+            {
+                for(std::size_t i = n - 1; i > 0; --i)
+                {
+                    T* cur = base + i * w;
+                    const T* prev = cur - w;
+
+                    for(std::size_t l = j; l < k; ++l)
+                        cur[l] -= prev[l];
+                }
+            }
+
+            c += k - j;
+        }
+    }, std::max<std::size_t>(minBlockSize / n, 1));
+}
+
+
+
+/** @brief Applies @p op(dst[x], src[x]) for every position @c x of a box with dimensions @p extents
+
+    Both arrays are row major, with weights given by @p dstStrides and @p srcStrides. The lines of the
+    last dimension are split between the threads, and are traversed contiguously if both strides are 1.
+*/
+template <typename T, typename U, class Op>
+void copyRegion (T* dst, const std::vector<std::size_t>& dstStrides,
+                 const U* src, const std::vector<std::size_t>& srcStrides,
+                 const std::vector<std::size_t>& extents, Op op)
+{
+    std::size_t d = extents.size();
+    std::size_t last = extents.back();
+    std::size_t lines = product(extents, 0, d - 1);
+
+    if(last == 0 || lines == 0)
+        return;
+
+
+    parallel::forBlocks(lines, [&](std::size_t begin, std::size_t end)
+    {
+        for(std::size_t line = begin; line < end; ++line)
+        {
+            std::size_t dstPos = 0, srcPos = 0, rem = line;
+
+            for(std::size_t p = d - 1; p-- > 0; rem /= extents[p])
+            {
+                dstPos += (rem % extents[p]) * dstStrides[p];
+                srcPos += (rem % extents[p]) * srcStrides[p];
+            }
+
+            T* x = dst + dstPos;
+            const U* y = src + srcPos;
+
+            if(dstStrides.back() == 1 && srcStrides.back() == 1)
+                for(std::size_t k = 0; k < last; ++k)
+                    op(x[k], y[k]);
+
+            else
+                for(std::size_t k = 0; k < last; ++k)
+                    op(x[k * dstStrides.back()], y[k * srcStrides.back()]);
+        }
+    }, std::max<std::size_t>(minBlockSize / last, 1));
+}
+
+} // namespace sat
+
+} // namespace impl
+
+
+
+/** @ingroup ContainerGroup
+    @copydoc SummedAreaTable.h
+*/
+//@{
+
+/** @brief Summed area table of a handy::Container
+
+    @tparam T The type used to accumulate the elements. When built from a Container, the default is given
+              by handy::impl::sat::Accumulator
+*/
+template <typename T>
+class SummedAreaTable
+{
+public:
+
+    using value_type = T;   ///< Type of the sums
+
+
+    /// Empty table. Call #build() before any query
+    SummedAreaTable () {}
+
+    /// Builds the table from the Container @p c
+    template <class Cnt>
+    SummedAreaTable (const Cnt& c)
+    {
+        build(c);
+    }
+
+
+
+    /** @brief Builds the table from scratch
+
+        @param c A Container exposing @c data(), @c numDimensions() and @c size(p), with contiguous storage or
+                 with the strides of each dimension given by @c strides(), as a handy::ContainerView
+    */
+    template <class Cnt>
+    void build (const Cnt& c)
+    {
+        dims.resize(c.numDimensions());
+
+        for(std::size_t p = 0; p < dims.size(); ++p)
+            dims[p] = c.size(p);
+
+
+        std::vector<std::size_t> padded(dims);
+
+        for(auto& x : padded)
+            ++x;
+
+        table = Container<T>(padded);
+
+        weights = impl::sat::strides(padded);
+
+
+        impl::sat::copyRegion(table.data() + std::accumulate(weights.begin(), weights.end(), std::size_t(0)), weights,
+                              c.data(), impl::sat::strides(c, dims), dims, [](T& x, const auto& y){ x = y; });
+
+        for(std::size_t p = 0; p < padded.size(); ++p)
+            impl::sat::scanAxis(table.data(), padded, p);
+    }
+
+
+
+    /** @brief Rebuilds the table after the elements of @p c inside the box <tt>[lo, hi)</tt> have changed
+
+        Only the elements of the table after @p lo are touched. The old values of the box are recovered
+        from the table itself, so the cost is proportional to the size of the region after @p lo, not to
+        the whole table.
+
+        @param c The same Container used to build the table, with the new values
+        @param lo The first position of the changed box
+        @param hi One past the last position of the changed box
+    */
+    template <class Cnt, class Lo, class Hi>
+    void update (const Cnt& c, const Lo& lo, const Hi& hi)
+    {
+        std::size_t d = dims.size();
+
+        std::vector<std::size_t> first(std::begin(lo), std::end(lo)), last(std::begin(hi), std::end(hi));
+        std::vector<std::size_t> box(d), extended(d), region(d);
+
+        for(std::size_t p = 0; p < d; ++p)
+        {
+            if(last[p] <= first[p])
+                return;
+
+            box[p] = last[p] - first[p];
+            extended[p] = box[p] + 1;
+            region[p] = dims[p] - first[p];
+        }
+
+        std::size_t start = std::inner_product(first.begin(), first.end(), weights.begin(), std::size_t(0));
+        std::size_t inner = std::accumulate(weights.begin(), weights.end(), std::size_t(0));
+
+
+        // The old values of the box, given by the adjacent differences of the table
+        std::vector<T> old(impl::sat::product(extended, 0, d));
+        std::vector<std::size_t> oldWeights = impl::sat::strides(extended);
+
+        impl::sat::copyRegion(old.data(), oldWeights, table.data() + start, weights, extended,
+                              [](T& x, const T& y){ x = y; });
+
+        for(std::size_t p = 0; p < d; ++p)
+            impl::sat::scanAxis(old.data(), extended, p, true);
+
+
+        // The difference between the new and old values, whose prefix sums are added to the table
+        std::vector<T> delta(impl::sat::product(region, 0, d), T{});
+        std::vector<std::size_t> deltaWeights = impl::sat::strides(region);
+        std::vector<std::size_t> srcWeights = impl::sat::strides(c, dims);
+
+        impl::sat::copyRegion(delta.data(), deltaWeights,
+                              c.data() + std::inner_product(first.begin(), first.end(), srcWeights.begin(), std::size_t(0)),
+                              srcWeights, box, [](T& x, const auto& y){ x = y; });
+
+        impl::sat::copyRegion(delta.data(), deltaWeights,
+                              old.data() + std::accumulate(oldWeights.begin(), oldWeights.end(), std::size_t(0)),
+                              oldWeights, box, [](T& x, const T& y){ x -= y; });
+
+        for(std::size_t p = 0; p < d; ++p)
+            impl::sat::scanAxis(delta.data(), region, p);
+
+        impl::sat::copyRegion(table.data() + start + inner, weights, delta.data(), deltaWeights, region,
+                              [](T& x, const T& y){ x += y; });
+    }
+
+    /// @copydoc update()
+    template <class Cnt>
+    void update (const Cnt& c, std::initializer_list<std::size_t> lo, std::initializer_list<std::size_t> hi)
+    {
+        update<Cnt, std::initializer_list<std::size_t>, std::initializer_list<std::size_t>>(c, lo, hi);
+    }
+
+
+
+    /** @brief Sum of the elements inside the box <tt>[lo, hi)</tt>
+
+        Takes exactly @f$ 2^d @f$ elements of the table, with no branch on the borders.
+
+        @param lo An iterable with the first position of the box in each dimension
+        @param hi An iterable with one past the last position of the box in each dimension
+    */
+    template <class Lo, class Hi>
+    T sum (const Lo& lo, const Hi& hi) const
+    {
+        std::size_t d = dims.size();
+
+        T res{};
+
+        for(std::size_t mask = 0; mask < (std::size_t(1) << d); ++mask)
+        {
+            std::size_t pos = 0, lower = 0;
+
+            auto l = std::begin(lo);
+            auto h = std::begin(hi);
+
+            for(std::size_t p = 0; p < d; ++p, ++l, ++h)
+            {
+                std::size_t bit = (mask >> p) & 1;
+
+                pos += std::size_t(bit ? *h : *l) * weights[p];
+                lower += 1 - bit;
+            }
+
+            res += (lower & 1) ? T(-table[pos]) : table[pos];
+        }
+
+        return res;
+    }
+
+    /// @copydoc sum()
+    T sum (std::initializer_list<std::size_t> lo, std::initializer_list<std::size_t> hi) const
+    {
+        return sum<std::initializer_list<std::size_t>, std::initializer_list<std::size_t>>(lo, hi);
+    }
+
+
+    /// Mean of the elements inside the box <tt>[lo, hi)</tt>. @copydetails sum()
+    template <class Lo, class Hi>
+    auto mean (const Lo& lo, const Hi& hi) const
+    {
+        using Type = std::common_type_t<T, double>;
+
+        Type volume = 1;
+
+        auto l = std::begin(lo);
+
+        for(auto h = std::begin(hi); h != std::end(hi); ++h, ++l)
+            volume *= Type(*h - *l);
+
+        return Type(sum(lo, hi)) / volume;
+    }
+
+    /// @copydoc mean()
+    auto mean (std::initializer_list<std::size_t> lo, std::initializer_list<std::size_t> hi) const
+    {
+        return mean<std::initializer_list<std::size_t>, std::initializer_list<std::size_t>>(lo, hi);
+    }
+
+
+
+    /// Size of each dimension of the original Container
+    std::size_t size (std::size_t p) const { return dims[p]; }
+
+    /// Number of dimensions
+    std::size_t numDimensions () const { return dims.size(); }
+
+    /// The table itself, with one extra zero element at the start of each dimension
+    const Container<T>& data () const { return table; }
+
+
+
+private:
+
+    Container<T> table;                 ///< The prefix sums
+
+    std::vector<std::size_t> dims;      ///< Dimensions of the original Container
+
+    std::vector<std::size_t> weights;   ///< Weights to access the table
+};
+
+
+/// Deduces the accumulator type from the element type of the Container
+template <class Cnt>
+SummedAreaTable (const Cnt&) -> SummedAreaTable<typename impl::sat::Accumulator<typename Cnt::value_type>::type>;
+
+//@}
+
+} // namespace handy
+
+
+#endif // HANDY_CONTAINER_SUMMED_AREA_TABLE_H
@@ -15,19 +15,34 @@
 #include "Helpers/Benchmark.h"
 #include "Helpers/HasMember.h"
 #include "Helpers/NamedTuple.h"
+#include "Helpers/Parallel.h"
 #include "Helpers/Print.h"
 #include "Helpers/Random.h"
 
 
 #include "Algorithms/Algorithms.h"
+#include "Algorithms/Parallel.h"
 
+#include "Container/Cast.h"
 #include "Container/Container.h"
+#include "Container/ContainerView.h"
+#include "Container/RingBuffer.h"
+#include "Container/SmallMatrix.h"
+#include "Container/SummedAreaTable.h"
 
 #include "Range/Range.h"
+#include "Range/Adaptors.h"
+#include "Range/Generator.h"
+#include "Range/MultiRange.h"
+#include "Range/Parallel.h"
 
 #include "Wrapper/Wrapper.h"
 
 #include "ZipIter/ZipIter.h"
+#include "ZipIter/Chunks.h"
+#include "ZipIter/Columns.h"
+#include "ZipIter/Prefetch.h"
+#include "ZipIter/Sort.h"
 
 
 // C++17
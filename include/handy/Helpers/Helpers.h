@@ -215,48 +215,127 @@ using IsTuple = IsSpecialization<std::decay_t<T>, std::tuple>;
 
 
 
+/// Verify if type @c T exposes its contiguous memory through a @c data() member function
+template <class T, typename = void>
+struct HasData : std::false_type {};
 
-/** @brief Apply a function to every element of a tuple
-	
- 	@param apply The function to be applied to tuple @c tup
-	@param tup A reference to a std::tuple
-	@param funcArgs Arguments to the @c apply function
-	@brief Apply a function to every element of a tuple, passing "funcArgs" as argument. In C++17 it is a lot easier.
+/// @copydoc HasData
+template <class T>
+struct HasData<T, std::void_t<decltype(std::declval<T&>().data())>> : std::true_type {};
+
+
+/// Verify if the elements of type @c T may be strided, which is told at runtime by an @c isContiguous() member function
+template <class T, typename = void>
+struct MaybeStrided : std::false_type {};
+
+/// @copydoc MaybeStrided
+template <class T>
+struct MaybeStrided<T, std::void_t<decltype(std::declval<const T&>().isContiguous())>> : std::true_type {};
+
+
+
+
+namespace impl
+{
+
+/// Number of elements of the half-closed range <tt>[Begin, End)</tt> with step @p Step
+constexpr std::size_t staticCount (std::ptrdiff_t begin, std::ptrdiff_t end, std::ptrdiff_t step)
+{
+    return step > 0 ? (begin < end ? std::size_t((end - begin + step - 1) / step) : 0) :
+           step < 0 ? (end < begin ? std::size_t((begin - end - step - 1) / -step) : 0) : 0;
+}
+
+/// The sequence <tt>Begin + Is * Step</tt>
+template <std::ptrdiff_t Begin, std::ptrdiff_t Step, std::size_t... Is>
+constexpr auto staticRange (std::index_sequence<Is...>)
+{
+    return std::integer_sequence<std::ptrdiff_t, (Begin + std::ptrdiff_t(Is) * Step)...>{};
+}
+
+} // namespace impl
+
+
+/** @brief The indices of the half-closed range <tt>[Begin, End)</tt> with step @p Step, as a
+           <tt>std::integer_sequence<std::ptrdiff_t, ...></tt>
+
+    It is the compile time version of handy::range(): <tt>StaticRange<0, 10, 3></tt> is the
+    sequence @c 0, @c 3, @c 6, @c 9.
 */
-template <class Apply, typename... Args, std::size_t... Is, typename... FuncArgs>
-void applyTuple (Apply apply, std::tuple<Args...>& tup, std::index_sequence<Is...>, FuncArgs&&... funcArgs)
+template <std::ptrdiff_t Begin, std::ptrdiff_t End, std::ptrdiff_t Step = 1>
+using StaticRange = decltype(impl::staticRange<Begin, Step>(std::make_index_sequence<impl::staticCount(Begin, End, Step)>()));
+
+
+
+/** @brief Calls @p f with each index of @p seq, as a @c std::integral_constant
+
+    The loop is fully unrolled, and each index is a compile time constant inside @p f, so it can
+    index a tuple or be a template argument:
+
+    @code{.cpp}
+    std::tuple<int, double, std::string> tup;
+
+    handy::staticFor<0, 3>([&](auto i){ std::cout << std::get<i>(tup) << "\n"; });
+    @endcode
+*/
+template <class F, typename T, T... Is>
+constexpr void staticFor (F&& f, std::integer_sequence<T, Is...>)
+{
+    ( f( std::integral_constant<T, Is>() ), ... );
+}
+
+/// Calls @p f with each index of <tt>handy::StaticRange<Begin, End, Step></tt>
+template <std::ptrdiff_t Begin, std::ptrdiff_t End, std::ptrdiff_t Step = 1, class F>
+constexpr void staticFor (F&& f)
+{
+    staticFor(f, StaticRange<Begin, End, Step>());
+}
+
+/// Calls @p f with each index of <tt>handy::StaticRange<0, End></tt>
+template <std::ptrdiff_t End, class F>
+constexpr void staticFor (F&& f)
 {
-    const auto& dummie = { ( apply( std::get<Is>(tup), std::forward<FuncArgs>(funcArgs)... ), int{} ) ... };
+    staticFor(f, StaticRange<0, End>());
 }
 
-/** @brief Delegate the call to applyTuple() generating a @link std::integer_sequence std::index_sequence @endlink
-		   to expand the std::tuple
-	@copydetails applyTuple
+
+/** @brief Calls @p f a single time, with all the indices of @p seq as @c std::integral_constant arguments,
+           returning its result
 */
-template <class Apply, typename... Args, typename... FuncArgs>
-void applyTuple (Apply apply, std::tuple<Args...>& tup, FuncArgs&&... funcArgs)
+template <class F, typename T, T... Is>
+constexpr decltype(auto) staticApply (F&& f, std::integer_sequence<T, Is...>)
 {
-    return applyTuple(apply, tup, std::make_index_sequence<sizeof...(Args)>(), std::forward<FuncArgs>(funcArgs)...);
+    return f( std::integral_constant<T, Is>()... );
 }
 
+/// Calls @p f with all the indices of <tt>handy::StaticRange<Begin, End, Step></tt>
+template <std::ptrdiff_t Begin, std::ptrdiff_t End, std::ptrdiff_t Step = 1, class F>
+constexpr decltype(auto) staticApply (F&& f)
+{
+    return staticApply(f, StaticRange<Begin, End, Step>());
+}
 
 
-/** @copydoc reverseArgs()
+
+/** @brief Apply a function to every element of a tuple
 	
-	@tparam Is Index arguments -- 0, 1, ..., P
-	@tparam Js Index arguments -- 0, 1, ..., sizeof(Args) - P
+ 	@param apply The function to be applied to tuple @c tup
+	@param tup A reference to a std::tuple
+	@param funcArgs Arguments to the @c apply function
+	@brief Apply a function to every element of a tuple, passing "funcArgs" as argument.
 */
-template <std::size_t P, class Apply, class... Args, std::size_t... Is, std::size_t... Js>
-decltype(auto) reverseArgs (Apply apply, std::tuple<Args...>&& tup, std::index_sequence<Is...>, std::index_sequence<Js...>)
+template <class Apply, typename... Args, typename... FuncArgs>
+void applyTuple (Apply apply, std::tuple<Args...>& tup, const FuncArgs&... funcArgs)
 {
-    return apply(std::get<Js+P>(tup)..., std::get<Is>(tup)...);
+    staticFor<sizeof...(Args)>([&](auto i){ apply( std::get< i >( tup ), funcArgs... ); });
 }
 
+
+
 /** @brief Reverses the order of variadic arguments given an index
  	
 	@tparam P The starting index to reverse
 	@param apply The function to apply after the reversing
-	@param tup The std::tuple that holds the arguments
+	@param args The arguments
 
 	Given an index P, this function reverses the order of the arguments from @f$ [0, 1, ..., P, ..., N] @f$ to
 	@f$ [P, ..., N, 0, 1, ..., P-1] @f$
@@ -266,9 +345,12 @@ decltype(auto) reverseArgs (Apply apply, std::tuple<Args...>&& tup, std::index_s
 template <std::size_t P, class Apply, class... Args>
 decltype(auto) reverseArgs (Apply apply, Args&&... args)
 {
-    return reverseArgs<P>(apply, std::forward_as_tuple(std::forward<Args>(args)...), 
-                          	 	 std::make_index_sequence<P>{}, 
-                          		 std::make_index_sequence<sizeof...(Args)-P>{});
+    auto tup = std::forward_as_tuple(std::forward<Args>(args)...);
+
+    return staticApply<0, sizeof...(Args)>([&](auto... is) -> decltype(auto)
+    {
+        return apply( std::get< (decltype(is)::value + P) % sizeof...(Args) >( tup )... );
+    });
 }
 
 
@@ -0,0 +1,314 @@
+/** @file
+
+    @brief A minimal thread pool used by the parallel facilities of handy
+
+    @details The pool is created on the first call to handy::threadPool(), having as many threads as
+             given by @c std::thread::hardware_concurrency (the calling thread included). You can override
+             this number by defining HANDY_NUM_THREADS before including handy.
+
+             A job is a number of tasks, indexed from @c 0, that are distributed dynamically among the
+             threads. The thread that calls handy::ThreadPool::run() also executes tasks, and only returns
+             when all of them are done. If any task throws, the remaining tasks are skipped and the first
+             exception is rethrown to the caller.
+
+             Calling handy::ThreadPool::run() from inside a task, or while another thread is running a job,
+             simply executes the tasks serially on the calling thread, so there is no deadlock.
+*/
+
+#ifndef HANDY_HELPERS_PARALLEL_H
+#define HANDY_HELPERS_PARALLEL_H
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <exception>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+
+
+namespace handy
+{
+
+/** @defgroup ParallelGroup Thread pool
+    @copydoc Parallel.h
+*/
+
+//@{
+/// The thread pool itself. You will rarely need more than the handy::threadPool() instance
+class ThreadPool
+{
+public:
+
+    /// Default number of threads, including the calling one
+    static std::size_t defaultSize ()
+    {
+    #ifdef HANDY_NUM_THREADS
+        return std::max<std::size_t>(HANDY_NUM_THREADS, 1);
+    #else
+        return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    #endif
+    }
+
+
+    /// Creates @p numThreads - 1 workers. The calling thread is the other one
+    ThreadPool (std::size_t numThreads = defaultSize())
+    {
+        for(std::size_t i = 1; i < numThreads; ++i)
+            workers.emplace_back([this]{ work(); });
+    }
+
+    ThreadPool (const ThreadPool&) = delete;
+
+    ThreadPool& operator = (const ThreadPool&) = delete;
+
+    ~ThreadPool ()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            stop = true;
+        }
+
+        wake.notify_all();
+
+        for(auto& worker : workers)
+            worker.join();
+    }
+
+
+    /// Number of threads executing a job, including the calling one
+    std::size_t size () const { return workers.size() + 1; }
+
+
+
+    /** @brief Executes @p f(i) for every @c i in <tt>[0, numTasks)</tt>, returning when all are done
+
+        @param numTasks Number of tasks
+        @param f A function taking the index of the task
+    */
+    template <class F>
+    void run (std::size_t numTasks, F&& f)
+    {
+        std::unique_lock<std::mutex> busy(runMutex, std::try_to_lock);
+
+        if(numTasks < 2 || workers.empty() || insideTask() || !busy.owns_lock())
+        {
+            for(std::size_t i = 0; i < numTasks; ++i)
+                f(i);
+
+            return;
+        }
+
+
+        Job job(numTasks, f);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            current = &job;
+            active = workers.size();
+            ++generation;
+        }
+
+        wake.notify_all();
+
+        execute(job);
+
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+
+            done.wait(lock, [&]{ return active == 0; });
+
+            current = nullptr;
+        }
+
+        if(job.error)
+            std::rethrow_exception(job.error);
+    }
+
+
+
+private:
+
+    /// A type erased reference to the function executing a task, along with the task counter
+    struct Job
+    {
+        template <class F>
+        Job (std::size_t numTasks, F& f) : numTasks(numTasks),
+                                           function(const_cast<void*>(static_cast<const void*>(&f))),
+                                           call([](void* g, std::size_t i){ (*static_cast<F*>(g))(i); }) {}
+
+        std::size_t numTasks;
+
+        void* function;
+        void (*call)(void*, std::size_t);
+
+        std::atomic<std::size_t> next{0};
+
+        std::mutex errorMutex;
+        std::exception_ptr error;
+    };
+
+
+    /// Tells if the current thread is executing a task
+    static bool& insideTask ()
+    {
+        static thread_local bool inside = false;
+
+        return inside;
+    }
+
+
+    /// Takes tasks from @p job until there is none left
+    static void execute (Job& job)
+    {
+        bool outer = insideTask();
+
+        insideTask() = true;
+
+        for(std::size_t i; (i = job.next++) < job.numTasks; )
+        {
+            try
+            {
+                job.call(job.function, i);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(job.errorMutex);
+
+                if(!job.error)
+                    job.error = std::current_exception();
+
+                job.next = job.numTasks;
+            }
+        }
+
+        insideTask() = outer;
+    }
+
+
+    /// Loop of the worker threads
+    void work ()
+    {
+        std::size_t seen = 0;
+
+        while(true)
+        {
+            Job* job;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+
+                wake.wait(lock, [&]{ return stop || generation != seen; });
+
+                if(stop)
+                    return;
+
+                seen = generation;
+                job = current;
+            }
+
+            execute(*job);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if(--active == 0)
+                    done.notify_one();
+            }
+        }
+    }
+
+
+
+    std::vector<std::thread> workers;   ///< The worker threads
+
+    std::mutex runMutex;                ///< Only one job at a time
+
+    std::mutex mutex;                   ///< Protects the variables below
+    std::condition_variable wake;       ///< Notifies the workers of a new job
+    std::condition_variable done;       ///< Notifies the caller that the workers are done
+
+    Job* current = nullptr;             ///< The current job
+    std::size_t generation = 0;         ///< Incremented at every new job
+    std::size_t active = 0;             ///< Number of workers still executing the current job
+    bool stop = false;                  ///< Tells the workers to finish
+};
+
+
+
+/// The global thread pool used by handy
+inline ThreadPool& threadPool ()
+{
+    static ThreadPool pool;
+
+    return pool;
+}
+
+
+
+/** @brief Tag asking a function to execute in parallel, in the handy::threadPool()
+
+    The work is split into tasks of @c grain elements, distributed dynamically between the threads. A
+    zero @c grain lets the function choose it. Use handy::par, or handy::par(grain) to set the grain.
+*/
+struct ParallelPolicy
+{
+    /// A policy with the given @p grain
+    constexpr ParallelPolicy operator () (std::size_t grain) const { return ParallelPolicy{grain}; }
+
+
+    /// Grain of @p n elements: the given one, or enough for about four tasks per thread
+    std::size_t grainFor (std::size_t n) const
+    {
+        return grain ? grain : std::max<std::size_t>(n / (4 * threadPool().size()), 1);
+    }
+
+
+    std::size_t grain = 0;  ///< Number of elements of each task
+};
+
+/// The parallel policy, with automatic grain
+inline constexpr ParallelPolicy par{};
+
+
+
+namespace impl
+{
+
+namespace parallel
+{
+
+/** @brief Splits <tt>[0, n)</tt> into at most one contiguous block per thread, calling @p f(begin, end) for each
+
+    The blocks depend only on @p n, @p grain and the size of the pool, so the split is deterministic.
+
+    @param n Number of elements
+    @param f A function taking the range <tt>[begin, end)</tt> of the block
+    @param grain Minimum number of elements of a block
+*/
+template <class F>
+void forBlocks (std::size_t n, F f, std::size_t grain = 1)
+{
+    grain = std::max<std::size_t>(grain, 1);
+
+    std::size_t numBlocks = std::min(threadPool().size(), (n + grain - 1) / grain);
+
+    threadPool().run(numBlocks, [&](std::size_t b)
+    {
+        f(n * b / numBlocks, n * (b + 1) / numBlocks);
+    });
+}
+
+} // namespace parallel
+
+} // namespace impl
+
+//@}
+
+} // namespace handy
+
+
+#endif // HANDY_HELPERS_PARALLEL_H
@@ -0,0 +1,775 @@
+/** @file
+
+    @brief Lazy range adaptors: mapped, filter, take, stride and concat
+
+    The adaptors wrap a range (a handy::Range, a container, a handy::Zip, another adaptor, ...) without
+    evaluating it. Each element is computed only when the iterator is dereferenced, so a chain of
+    adaptors is a single loop, with no intermediate containers:
+
+    @code{.cpp}
+    auto squares = handy::mapped(handy::range(10), [](int x){ return x * x; });
+
+    for(int x : handy::take(handy::filter(squares, [](int x){ return x % 2; }), 3))    // 1, 9, 25
+        std::cout << x << "\n";
+
+    for(auto& x : handy::stride(v, 2))      // Every other element of v, by reference
+        x = 0;
+    @endcode
+
+    Called without the range, the adaptors return a function taking it, so they can be chained with
+    the pipeline operator of Algorithms.h:
+
+    @code{.cpp}
+    bool ok = handy::range(100) & handy::mapped(f) & handy::stride(4) & handy::all_of(isValid);
+    @endcode
+
+    The iterators keep the category of the underlying range where possible: handy::mapped(),
+    handy::take() and handy::stride() of random access ranges are random access, with @c size() and
+    @c operator[], so they can be zipped with handy::zip() or split with handy::parallelFor().
+    handy::filter() and handy::concat() are forward, or input if a range they take is.
+
+    Ranges given as lvalues are held by reference, and rvalues are moved into the adaptor.
+
+    @note The map adaptor is named handy::mapped(), so it does not clash with @c std::map when both
+          namespaces are used
+*/
+
+#ifndef HANDY_RANGE_ADAPTORS_H
+#define HANDY_RANGE_ADAPTORS_H
+
+#include "Range.h"
+
+#include <tuple>
+#include <optional>
+#include <limits>
+
+
+namespace handy
+{
+
+namespace impl
+{
+
+namespace adaptors
+{
+
+/// How a range is held: by reference if it is an lvalue, by value otherwise
+template <class R>
+using Stored = std::conditional_t<std::is_lvalue_reference<R>::value, R, std::decay_t<R>>;
+
+/// The iterator of the range @p R
+template <class R>
+using IteratorOf = decltype(std::begin(std::declval<R&>()));
+
+/// The category of the iterator @p Iter
+template <class Iter>
+using CategoryOf = typename std::iterator_traits<Iter>::iterator_category;
+
+/// If @p Iter is a random access iterator
+template <class Iter>
+constexpr bool isRandomAccess = std::is_same<CategoryOf<Iter>, std::random_access_iterator_tag>::value;
+
+/// Tells if the size of @p T is known, through @c std::size
+template <typename T, typename = void>
+struct IsSized : std::false_type {};
+
+template <typename T>
+struct IsSized<T, std::void_t<decltype(std::size(std::declval<T&>()))>> : std::true_type {};
+
+
+/** @brief Holds a range by value, or by reference if @p R is a reference
+
+    The range is always given as non const, so the elements of owned ranges can be modified through
+    a const adaptor, as the ones of ranges held by reference.
+*/
+template <class R>
+struct Holder
+{
+    R& get () const { return range; }
+
+    mutable R range;    ///< The range
+};
+
+template <class R>
+struct Holder<R&>
+{
+    R& get () const { return range; }
+
+    R& range;           ///< The range
+};
+
+
+/** @brief If two iterators are equal
+
+    Compared through @c operator!=, as the forward iterator of a handy::Range is only different from
+    the end while it is inside the range, being never equal to the end of an infinite range.
+*/
+template <class Iter>
+bool same (const Iter& it1, const Iter& it2)
+{
+    return !(it1 != it2);
+}
+
+} // namespace adaptors
+
+} // namespace impl
+
+
+
+/** @ingroup RangeGroup
+    @copydoc Adaptors.h
+*/
+//@{
+
+/** @brief Applies a function to each element of a range, when it is dereferenced
+
+    @tparam R The range, a reference if it is held by reference
+    @tparam F The function
+*/
+template <class R, class F>
+class Map
+{
+public:
+
+    using base_iterator = impl::adaptors::IteratorOf<R>;
+
+
+    /// Iterator with the same category of the base one
+    class iterator
+    {
+    public:
+
+        using reference         = decltype(std::declval<const F&>()(*std::declval<base_iterator&>()));
+        using value_type        = std::decay_t<reference>;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = impl::adaptors::CategoryOf<base_iterator>;
+
+
+        iterator (const Map& map, base_iterator it) : map(&map), it(it) {}
+
+
+        reference operator * () const { return map->f(*it); }
+
+        reference operator [] (difference_type inc) const { return map->f(it[inc]); }
+
+
+        iterator& operator ++ () { ++it; return *this; }
+
+        iterator& operator -- () { --it; return *this; }
+
+        iterator operator ++ (int) { iterator temp{*this}; ++it; return temp; }
+
+        iterator operator -- (int) { iterator temp{*this}; --it; return temp; }
+
+        iterator& operator += (difference_type inc) { it += inc; return *this; }
+
+        iterator& operator -= (difference_type inc) { it -= inc; return *this; }
+
+        friend iterator operator + (iterator iter, difference_type inc) { return iter += inc; }
+
+        friend iterator operator + (difference_type inc, iterator iter) { return iter += inc; }
+
+        friend iterator operator - (iterator iter, difference_type inc) { return iter -= inc; }
+
+        friend difference_type operator - (const iterator& iter1, const iterator& iter2) { return iter1.it - iter2.it; }
+
+
+        friend bool operator == (const iterator& iter1, const iterator& iter2) { return impl::adaptors::same(iter1.it, iter2.it); }
+
+        friend bool operator != (const iterator& iter1, const iterator& iter2) { return iter1.it != iter2.it; }
+
+        friend bool operator <  (const iterator& iter1, const iterator& iter2) { return iter1.it < iter2.it; }
+
+        friend bool operator >  (const iterator& iter1, const iterator& iter2) { return iter1.it > iter2.it; }
+
+        friend bool operator <= (const iterator& iter1, const iterator& iter2) { return iter1.it <= iter2.it; }
+
+        friend bool operator >= (const iterator& iter1, const iterator& iter2) { return iter1.it >= iter2.it; }
+
+
+    private:
+
+        const Map* map;             ///< The adaptor, for the function
+        mutable base_iterator it;   ///< The base iterator. Mutable, as some iterators can only be dereferenced if not const
+    };
+
+    using const_iterator = iterator;
+
+    using value_type = typename iterator::value_type;
+
+    using iterator_category = typename iterator::iterator_category;
+
+
+    Map (R range, F f) : range{ std::forward<R>(range) }, f(f) {}
+
+
+    iterator begin () const { return iterator(*this, std::begin(range.get())); }
+
+    iterator end () const { return iterator(*this, std::end(range.get())); }
+
+    /// Number of elements, if the base range has a size
+    template <class B = R, std::enable_if_t<impl::adaptors::IsSized<B>::value>* = nullptr>
+    std::size_t size () const { return std::size(range.get()); }
+
+    /// The element at position @p pos, for random access ranges
+    decltype(auto) operator [] (std::size_t pos) const { return f(std::begin(range.get())[pos]); }
+
+
+private:
+
+    impl::adaptors::Holder<R> range;    ///< The base range
+    F f;                ///< The function
+};
+
+
+
+/** @brief The elements of a range satisfying a predicate, skipped as the iterator advances
+
+    The iterator is forward (or input, for input ranges). Each call to #begin() searches for the first element.
+*/
+template <class R, class P>
+class Filter
+{
+public:
+
+    using base_iterator = impl::adaptors::IteratorOf<R>;
+
+
+    class iterator
+    {
+    public:
+
+        using reference         = decltype(*std::declval<base_iterator&>());
+        using value_type        = std::decay_t<reference>;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::conditional_t<std::is_same<impl::adaptors::CategoryOf<base_iterator>, std::input_iterator_tag>::value,
+                                                     std::input_iterator_tag, std::forward_iterator_tag>;
+
+
+        iterator (const Filter& filter, base_iterator it) : filter(&filter), it(it) { skip(); }
+
+
+        reference operator * () const { return *it; }
+
+
+        iterator& operator ++ () { ++it; skip(); return *this; }
+
+        iterator operator ++ (int) { iterator temp{*this}; ++*this; return temp; }
+
+
+        friend bool operator == (const iterator& iter1, const iterator& iter2) { return impl::adaptors::same(iter1.it, iter2.it); }
+
+        friend bool operator != (const iterator& iter1, const iterator& iter2) { return iter1.it != iter2.it; }
+
+
+    private:
+
+        /// Advances up to the next element satisfying the predicate, or the end
+        void skip ()
+        {
+            auto last = std::end(filter->range.get());
+
+            while(it != last && !filter->pred(*it))
+                ++it;
+        }
+
+
+        const Filter* filter;       ///< The adaptor, for the predicate and the end
+        mutable base_iterator it;   ///< The base iterator
+    };
+
+    using const_iterator = iterator;
+
+    using value_type = typename iterator::value_type;
+
+    using iterator_category = typename iterator::iterator_category;
+
+
+    Filter (R range, P pred) : range{ std::forward<R>(range) }, pred(pred) {}
+
+
+    iterator begin () const { return iterator(*this, std::begin(range.get())); }
+
+    iterator end () const { return iterator(*this, std::end(range.get())); }
+
+
+private:
+
+    impl::adaptors::Holder<R> range;    ///< The base range
+    P pred;             ///< The predicate
+};
+
+
+
+/** @brief The first @c n elements of a range, or all of them if it is shorter
+
+    The range can be infinite, as an handy::irange(). The iterator counts its position, so it has the
+    category of the base one.
+*/
+template <class R>
+class Take
+{
+public:
+
+    using base_iterator = impl::adaptors::IteratorOf<R>;
+
+    static constexpr bool sized = impl::adaptors::IsSized<R>::value;
+
+
+    class iterator
+    {
+    public:
+
+        using reference         = decltype(*std::declval<base_iterator&>());
+        using value_type        = std::decay_t<reference>;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = impl::adaptors::CategoryOf<base_iterator>;
+
+
+        iterator (base_iterator it, std::size_t pos) : it(it), pos(pos) {}
+
+
+        reference operator * () const { return *it; }
+
+        reference operator [] (difference_type inc) const { return it[inc]; }
+
+
+        iterator& operator ++ () { ++it; ++pos; return *this; }
+
+        iterator& operator -- () { --it; --pos; return *this; }
+
+        iterator operator ++ (int) { iterator temp{*this}; ++*this; return temp; }
+
+        iterator operator -- (int) { iterator temp{*this}; --*this; return temp; }
+
+        iterator& operator += (difference_type inc) { it += inc; pos += inc; return *this; }
+
+        iterator& operator -= (difference_type inc) { it -= inc; pos -= inc; return *this; }
+
+        friend iterator operator + (iterator iter, difference_type inc) { return iter += inc; }
+
+        friend iterator operator + (difference_type inc, iterator iter) { return iter += inc; }
+
+        friend iterator operator - (iterator iter, difference_type inc) { return iter -= inc; }
+
+        friend difference_type operator - (const iterator& iter1, const iterator& iter2)
+        {
+            return difference_type(iter1.pos) - difference_type(iter2.pos);
+        }
+
+
+        /// Equal at the same position, or when the base range ends first
+        friend bool operator == (const iterator& iter1, const iterator& iter2)
+        {
+            return iter1.pos == iter2.pos || impl::adaptors::same(iter1.it, iter2.it);
+        }
+
+        friend bool operator != (const iterator& iter1, const iterator& iter2) { return !(iter1 == iter2); }
+
+        friend bool operator <  (const iterator& iter1, const iterator& iter2) { return iter1.pos < iter2.pos; }
+
+        friend bool operator >  (const iterator& iter1, const iterator& iter2) { return iter1.pos > iter2.pos; }
+
+        friend bool operator <= (const iterator& iter1, const iterator& iter2) { return iter1.pos <= iter2.pos; }
+
+        friend bool operator >= (const iterator& iter1, const iterator& iter2) { return iter1.pos >= iter2.pos; }
+
+
+    private:
+
+        mutable base_iterator it;   ///< The base iterator
+        std::size_t pos;            ///< Number of elements before it
+    };
+
+    using const_iterator = iterator;
+
+    using value_type = typename iterator::value_type;
+
+    using iterator_category = typename iterator::iterator_category;
+
+
+    Take (R range, std::size_t n) : range{ std::forward<R>(range) }, n(n) {}
+
+
+    iterator begin () const { return iterator(std::begin(range.get()), 0); }
+
+    iterator end () const
+    {
+        if constexpr(impl::adaptors::isRandomAccess<base_iterator> && sized)
+            return iterator(std::begin(range.get()) + size(), size());
+
+        else
+            return iterator(std::end(range.get()), n);
+    }
+
+    /// Number of elements, if the base range has a size
+    template <bool S = sized, std::enable_if_t<S>* = nullptr>
+    std::size_t size () const { return std::min<std::size_t>(n, std::size(range.get())); }
+
+    /// The element at position @p pos, for random access ranges
+    decltype(auto) operator [] (std::size_t pos) const { return std::begin(range.get())[pos]; }
+
+
+private:
+
+    impl::adaptors::Holder<R> range;    ///< The base range
+    std::size_t n;      ///< Maximum number of elements
+};
+
+
+
+/** @brief Every @c k elements of a range, starting at the first
+
+    For random access ranges, the position of the element @c i is computed as <tt>i * k</tt>, so the
+    iterator is also random access.
+*/
+template <class R>
+class Stride
+{
+public:
+
+    using base_iterator = impl::adaptors::IteratorOf<R>;
+
+    static constexpr bool randomAccess = impl::adaptors::isRandomAccess<base_iterator> && impl::adaptors::IsSized<R>::value;
+
+
+    class iterator
+    {
+    public:
+
+        using reference         = decltype(*std::declval<base_iterator&>());
+        using value_type        = std::decay_t<reference>;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::conditional_t<randomAccess, std::random_access_iterator_tag,
+                                                     std::conditional_t<impl::adaptors::isRandomAccess<base_iterator>, std::forward_iterator_tag,
+                                                                        impl::adaptors::CategoryOf<base_iterator>>>;
+
+
+        iterator (const Stride& stride, base_iterator it, std::size_t pos) : stride(&stride), it(it), pos(pos) {}
+
+
+        reference operator * () const { return *it; }
+
+        reference operator [] (difference_type inc) const { return *(*this + inc); }
+
+
+        iterator& operator ++ ()
+        {
+            ++pos;
+
+            if constexpr(randomAccess)
+                it = stride->at(pos);
+
+            else
+            {
+                auto last = std::end(stride->range.get());
+
+                for(std::size_t i = 0; i < stride->k && it != last; ++i)
+                    ++it;
+            }
+
+            return *this;
+        }
+
+        iterator& operator -- () { return *this -= 1; }
+
+        iterator operator ++ (int) { iterator temp{*this}; ++*this; return temp; }
+
+        iterator operator -- (int) { iterator temp{*this}; --*this; return temp; }
+
+        iterator& operator += (difference_type inc) { pos += inc; it = stride->at(pos); return *this; }
+
+        iterator& operator -= (difference_type inc) { pos -= inc; it = stride->at(pos); return *this; }
+
+        friend iterator operator + (iterator iter, difference_type inc) { return iter += inc; }
+
+        friend iterator operator + (difference_type inc, iterator iter) { return iter += inc; }
+
+        friend iterator operator - (iterator iter, difference_type inc) { return iter -= inc; }
+
+        friend difference_type operator - (const iterator& iter1, const iterator& iter2)
+        {
+            return difference_type(iter1.pos) - difference_type(iter2.pos);
+        }
+
+
+        /// Equal at the same position, or when both reached the end of the base range
+        friend bool operator == (const iterator& iter1, const iterator& iter2)
+        {
+            return iter1.pos == iter2.pos || impl::adaptors::same(iter1.it, iter2.it);
+        }
+
+        friend bool operator != (const iterator& iter1, const iterator& iter2) { return !(iter1 == iter2); }
+
+        friend bool operator <  (const iterator& iter1, const iterator& iter2) { return iter1.pos < iter2.pos; }
+
+        friend bool operator >  (const iterator& iter1, const iterator& iter2) { return iter1.pos > iter2.pos; }
+
+        friend bool operator <= (const iterator& iter1, const iterator& iter2) { return iter1.pos <= iter2.pos; }
+
+        friend bool operator >= (const iterator& iter1, const iterator& iter2) { return iter1.pos >= iter2.pos; }
+
+
+    private:
+
+        const Stride* stride;       ///< The adaptor
+        mutable base_iterator it;   ///< The base iterator
+        std::size_t pos;            ///< Number of elements before it
+    };
+
+    using const_iterator = iterator;
+
+    using value_type = typename iterator::value_type;
+
+    using iterator_category = typename iterator::iterator_category;
+
+
+    /// Every @p k elements of @p range. A @p k of zero is taken as one
+    Stride (R range, std::size_t k) : range{ std::forward<R>(range) }, k(std::max<std::size_t>(k, 1)) {}
+
+
+    iterator begin () const { return iterator(*this, std::begin(range.get()), 0); }
+
+    iterator end () const
+    {
+        if constexpr(randomAccess)
+            return iterator(*this, at(size()), size());
+
+        else
+            return iterator(*this, std::end(range.get()), std::numeric_limits<std::size_t>::max());
+    }
+
+    /// Number of elements, if the base range has a size
+    template <class B = R, std::enable_if_t<impl::adaptors::IsSized<B>::value>* = nullptr>
+    std::size_t size () const { return (std::size(range.get()) + k - 1) / k; }
+
+    /// The element at position @p pos, for random access ranges
+    decltype(auto) operator [] (std::size_t pos) const { return std::begin(range.get())[pos * k]; }
+
+
+private:
+
+    /// Iterator to the base element of position @p pos, clamped to the end
+    base_iterator at (std::size_t pos) const
+    {
+        return std::begin(range.get()) + std::min<std::size_t>(pos * k, std::size(range.get()));
+    }
+
+
+    impl::adaptors::Holder<R> range;    ///< The base range
+    std::size_t k;      ///< Distance between the elements
+};
+
+
+
+/** @brief The elements of several ranges, one after the other
+
+    The reference type is the reference of the ranges, if they are all the same, or their common type.
+    The iterator is forward, or input if any of the ranges is. Each call to #begin() takes the begin
+    of every range, and #end() takes none, so single pass ranges are only started once.
+*/
+template <class... Rs>
+class Concat
+{
+public:
+
+    static constexpr std::size_t M = sizeof...(Rs);
+
+    using Iters = std::tuple<impl::adaptors::IteratorOf<Rs>...>;
+
+    static constexpr bool input = !And_v<!std::is_same<impl::adaptors::CategoryOf<impl::adaptors::IteratorOf<Rs>>, std::input_iterator_tag>::value...>;
+
+
+    class iterator
+    {
+    public:
+
+        using reference         = std::conditional_t<And_v<std::is_same<decltype(*std::declval<impl::adaptors::IteratorOf<GetArg_t<0, Rs...>>&>()),
+                                                                        decltype(*std::declval<impl::adaptors::IteratorOf<Rs>&>())>::value...>,
+                                                     decltype(*std::declval<impl::adaptors::IteratorOf<GetArg_t<0, Rs...>>&>()),
+                                                     std::common_type_t<std::decay_t<decltype(*std::declval<impl::adaptors::IteratorOf<Rs>&>())>...>>;
+        using value_type        = std::decay_t<reference>;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::conditional_t<input, std::input_iterator_tag, std::forward_iterator_tag>;
+
+
+        /// The end iterator, past the last range
+        explicit iterator (const Concat& concat) : concat(&concat), k(M) {}
+
+        /// Iterator at the first element of the ranges starting at @p its
+        iterator (const Concat& concat, Iters its) : concat(&concat), k(0), its(std::move(its)) { skip(); }
+
+
+        reference operator * () const
+        {
+            return visit([](auto& it, auto&, auto) -> reference { return *it; });
+        }
+
+
+        iterator& operator ++ ()
+        {
+            visit([](auto& it, auto&, auto){ ++it; return 0; });
+
+            skip();
+
+            return *this;
+        }
+
+        iterator operator ++ (int) { iterator temp{*this}; ++*this; return temp; }
+
+
+        friend bool operator == (const iterator& iter1, const iterator& iter2)
+        {
+            return iter1.k == iter2.k && (iter1.k == M || iter1.visit([&](auto& it, auto&, auto i)
+            {
+                return impl::adaptors::same(it, std::get<decltype(i)::value>(*iter2.its));
+            }));
+        }
+
+        friend bool operator != (const iterator& iter1, const iterator& iter2) { return !(iter1 == iter2); }
+
+
+    private:
+
+        /// Calls @p g with the iterator and the range @c k, and the index @c k as a @c std::integral_constant
+        template <std::size_t I = 0, class G>
+        decltype(auto) visit (G g) const
+        {
+            if constexpr(I + 1 < M)
+                if(k != I)
+                    return visit<I + 1>(g);
+
+            return g(std::get<I>(*its), std::get<I>(concat->ranges), std::integral_constant<std::size_t, I>());
+        }
+
+        /// Goes to the next range while the current one is at its end
+        void skip ()
+        {
+            while(k < M && visit([](auto& it, auto& range, auto){ return impl::adaptors::same(it, std::end(range)); }))
+                ++k;
+        }
+
+
+        const Concat* concat;   ///< The adaptor
+        std::size_t k;          ///< Index of the current range
+        mutable std::optional<Iters> its;   ///< Iterators to each range, but for the end. Only the one of the current range is used
+    };
+
+    using const_iterator = iterator;
+
+    using value_type = typename iterator::value_type;
+
+    using iterator_category = typename iterator::iterator_category;
+
+
+    Concat (Rs... ranges) : ranges(std::forward<Rs>(ranges)...) {}
+
+
+    iterator begin () const { return iterator(*this, begins(std::index_sequence_for<Rs...>())); }
+
+    iterator end () const { return iterator(*this); }
+
+    /// Total number of elements, if all the ranges have a size
+    template <bool S = And_v<impl::adaptors::IsSized<Rs>::value...>, std::enable_if_t<S>* = nullptr>
+    std::size_t size () const
+    {
+        return std::apply([](const auto&... range){ return (std::size_t(std::size(range)) + ...); }, ranges);
+    }
+
+
+private:
+
+    template <std::size_t... Is>
+    Iters begins (std::index_sequence<Is...>) const
+    {
+        return Iters(std::begin(std::get<Is>(ranges))...);
+    }
+
+
+    mutable std::tuple<Rs...> ranges;   ///< The ranges
+};
+
+
+
+/** @name
+    @brief Return the adaptors of a range, or a function taking the range, for the pipeline operator of Algorithms.h
+*/
+//@{
+
+/// Calls @p f on each element of @p range
+template <class R, class F>
+auto mapped (R&& range, F f)
+{
+    return Map<impl::adaptors::Stored<R&&>, F>(std::forward<R>(range), f);
+}
+
+/// @copydoc mapped()
+template <class F>
+auto mapped (F f)
+{
+    return [f](auto&& range){ return handy::mapped(std::forward<decltype(range)>(range), f); };
+}
+
+
+/// The elements of @p range for which @p pred returns @c true
+template <class R, class P>
+auto filter (R&& range, P pred)
+{
+    return Filter<impl::adaptors::Stored<R&&>, P>(std::forward<R>(range), pred);
+}
+
+/// @copydoc filter()
+template <class P>
+auto filter (P pred)
+{
+    return [pred](auto&& range){ return handy::filter(std::forward<decltype(range)>(range), pred); };
+}
+
+
+/// The first @p n elements of @p range
+template <class R>
+auto take (R&& range, std::size_t n)
+{
+    return Take<impl::adaptors::Stored<R&&>>(std::forward<R>(range), n);
+}
+
+/// @copydoc take()
+inline auto take (std::size_t n)
+{
+    return [n](auto&& range){ return handy::take(std::forward<decltype(range)>(range), n); };
+}
+
+
+/// Every @p k elements of @p range
+template <class R>
+auto stride (R&& range, std::size_t k)
+{
+    return Stride<impl::adaptors::Stored<R&&>>(std::forward<R>(range), k);
+}
+
+/// @copydoc stride()
+inline auto stride (std::size_t k)
+{
+    return [k](auto&& range){ return handy::stride(std::forward<decltype(range)>(range), k); };
+}
+
+
+/// The elements of all the @p ranges, one after the other
+template <class... Rs>
+auto concat (Rs&&... ranges)
+{
+    return Concat<impl::adaptors::Stored<Rs&&>...>(std::forward<Rs>(ranges)...);
+}
+//@}
+
+//@}
+
+} // namespace handy
+
+
+#endif // HANDY_RANGE_ADAPTORS_H
@@ -0,0 +1,427 @@
+/** @file
+
+    @brief Lazy ranges produced by a coroutine
+
+    A handy::Generator is the return type of a C++20 coroutine that gives its elements with
+    @c co_yield. The body only runs as the range is iterated, one element at a time, so streams can
+    be produced without ever being stored:
+
+    @code{.cpp}
+    handy::Generator<std::string> lines (std::istream& is)
+    {
+        for(std::string line; std::getline(is, line);)
+            co_yield line;
+    }
+
+    handy::Generator<Row> scan (Table& table)
+    {
+        for(auto page = table.firstPage(); page; page = table.nextPage(page))
+            co_yield handy::elementsOf(rows(page));      // All the elements of another generator
+    }
+
+    for(const auto& line : lines(file))
+        parse(line);
+    @endcode
+
+    A generator is an input range: it can be used in range-for loops, with handy::zip() and with the
+    algorithms and adaptors taking input ranges. Its iterator refers to the yielded object itself,
+    without copies, until the generator is resumed.
+
+    Nested generators given to handy::elementsOf() are resumed directly from the consumer, and pass
+    the control back to their parent by symmetric transfer when they finish, so deep recursions do
+    not grow the stack.
+
+    The frames of the coroutines are allocated from a per thread pool of recycled blocks, unless the
+    compiler is able to elide the allocation altogether.
+
+    @note Only available when the compiler supports coroutines (@c -std=c++20)
+*/
+
+#ifndef HANDY_RANGE_GENERATOR_H
+#define HANDY_RANGE_GENERATOR_H
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <array>
+#include <utility>
+#include <type_traits>
+#include <new>
+
+
+namespace handy
+{
+
+namespace impl
+{
+
+namespace generator
+{
+
+/** @brief Thread local free lists of coroutine frames, by size class
+
+    Frames of up to @c classes * @c granularity bytes are rounded up to a multiple of @c granularity,
+    and their memory is kept in the list of that size when released, up to @c maxFree blocks per list.
+*/
+class FramePool
+{
+public:
+
+    static constexpr std::size_t granularity = 64;     ///< Bytes between the size classes
+    static constexpr std::size_t classes = 16;          ///< Number of size classes
+    static constexpr std::size_t maxFree = 64;          ///< Maximum number of free blocks per class
+
+
+    /// The pool of the current thread
+    static FramePool& local ()
+    {
+        thread_local FramePool pool;
+
+        return pool;
+    }
+
+
+    void* allocate (std::size_t n)
+    {
+        std::size_t c = (n + granularity - 1) / granularity;
+
+        if(c == 0 || c > classes)
+            return ::operator new(n);
+
+        if(Block* block = free[c - 1])
+        {
+            free[c - 1] = block->next;
+            --count[c - 1];
+
+            return block;
+        }
+
+        return ::operator new(c * granularity);
+    }
+
+    void deallocate (void* p, std::size_t n)
+    {
+        std::size_t c = (n + granularity - 1) / granularity;
+
+        if(c == 0 || c > classes || count[c - 1] == maxFree)
+            return ::operator delete(p);
+
+        free[c - 1] = ::new (p) Block{ free[c - 1] };
+        ++count[c - 1];
+    }
+
+
+    ~FramePool ()
+    {
+        for(Block* block : free)
+            while(block)
+                ::operator delete(std::exchange(block, block->next));
+    }
+
+
+private:
+
+    /// A free block, linking to the next one
+    struct Block
+    {
+        Block* next;
+    };
+
+    std::array<Block*, classes> free{};         ///< The first free block of each class
+    std::array<std::size_t, classes> count{};   ///< Number of free blocks of each class
+};
+
+
+/// Tag for yielding all the elements of a generator, created by handy::elementsOf()
+template <class G>
+struct ElementsOf
+{
+    G gen;  ///< The nested generator
+};
+
+} // namespace generator
+
+} // namespace impl
+
+
+
+/** @ingroup RangeGroup
+    @copydoc Generator.h
+*/
+//@{
+
+/** @brief A lazy input range whose elements are yielded by a coroutine
+
+    @tparam T The type of the elements. If it is a reference, the iterator gives that reference,
+              otherwise a const reference to the yielded object
+*/
+template <typename T>
+class Generator
+{
+public:
+
+    class promise_type;
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    using value_type = std::remove_cv_t<std::remove_reference_t<T>>;
+
+    using reference = std::conditional_t<std::is_reference<T>::value, T, const T&>;
+
+    using pointer = std::add_pointer_t<reference>;
+
+
+    /** @brief The promise of the coroutine
+
+        Each promise points to the root generator, the one being iterated. The root holds the
+        yielded value and the innermost generator currently running, which is the one resumed.
+    */
+    class promise_type
+    {
+    public:
+
+        Generator get_return_object () noexcept
+        {
+            active = handle_type::from_promise(*this);
+
+            return Generator(active);
+        }
+
+
+        std::suspend_always initial_suspend () const noexcept { return {}; }
+
+        /// Returns the control to the parent generator, if any, or to the consumer
+        auto final_suspend () const noexcept
+        {
+            struct FinalAwaiter
+            {
+                bool await_ready () const noexcept { return false; }
+
+                std::coroutine_handle<> await_suspend (handle_type h) noexcept
+                {
+                    promise_type& p = h.promise();
+
+                    if(p.parent)
+                    {
+                        p.root->active = p.parent;
+
+                        return p.parent;
+                    }
+
+                    return std::noop_coroutine();
+                }
+
+                void await_resume () const noexcept {}
+            };
+
+            return FinalAwaiter{};
+        }
+
+
+        /// Yields a value, keeping only its address, valid until the coroutine is resumed
+        std::suspend_always yield_value (reference value) noexcept
+        {
+            root->value = std::addressof(value);
+
+            return {};
+        }
+
+
+        /// Runs the nested generator up to its end, with its elements given to the consumer of the root one
+        auto yield_value (impl::generator::ElementsOf<Generator> nested) noexcept
+        {
+            struct NestedAwaiter
+            {
+                bool await_ready () const noexcept { return !gen.handle; }
+
+                handle_type await_suspend (handle_type h) noexcept
+                {
+                    promise_type& child = gen.handle.promise();
+
+                    child.root = h.promise().root;
+                    child.parent = h;
+                    child.root->active = gen.handle;
+
+                    return gen.handle;
+                }
+
+                void await_resume ()
+                {
+                    if(gen.handle && gen.handle.promise().exception)
+                        std::rethrow_exception(gen.handle.promise().exception);
+                }
+
+                Generator gen;
+            };
+
+            return NestedAwaiter{ std::move(nested.gen) };
+        }
+
+
+        void return_void () const noexcept {}
+
+        /// Stores the exception, rethrown by the iterator of the root, or by the @c co_yield of the parent
+        void unhandled_exception () noexcept
+        {
+            exception = std::current_exception();
+        }
+
+        /// Disallow @c co_await inside generators
+        template <typename U>
+        std::suspend_never await_transform (U&&) = delete;
+
+
+        /// @name Frames allocated from the handy::impl::generator::FramePool of the thread
+        //@{
+        static void* operator new (std::size_t n)
+        {
+            return impl::generator::FramePool::local().allocate(n);
+        }
+
+        static void operator delete (void* p, std::size_t n) noexcept
+        {
+            impl::generator::FramePool::local().deallocate(p, n);
+        }
+        //@}
+
+
+    private:
+
+        friend Generator;
+
+        pointer value = nullptr;                ///< The last value yielded (only in the root)
+        std::exception_ptr exception;           ///< Exception thrown by the coroutine
+
+        promise_type* root = this;              ///< The generator being iterated
+        handle_type parent;                     ///< The generator that yielded this one, if any
+        handle_type active;                     ///< The innermost generator running (only in the root)
+    };
+
+
+
+    /// Input iterator, resuming the coroutine at each increment
+    class iterator
+    {
+    public:
+
+        using value_type        = Generator::value_type;
+        using reference         = Generator::reference;
+        using pointer           = Generator::pointer;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::input_iterator_tag;
+
+
+        /// The end iterator
+        iterator () = default;
+
+        explicit iterator (handle_type handle) : handle(handle) {}
+
+
+        reference operator * () const { return static_cast<reference>(*handle.promise().value); }
+
+        pointer operator -> () const { return handle.promise().value; }
+
+
+        iterator& operator ++ ()
+        {
+            Generator::resume(handle);
+
+            return *this;
+        }
+
+        void operator ++ (int) { ++*this; }
+
+
+        friend bool operator == (const iterator& iter1, const iterator& iter2)
+        {
+            return iter1.done() == iter2.done() && (iter1.done() || iter1.handle == iter2.handle);
+        }
+
+        friend bool operator != (const iterator& iter1, const iterator& iter2) { return !(iter1 == iter2); }
+
+
+    private:
+
+        bool done () const { return !handle || handle.done(); }
+
+
+        handle_type handle;     ///< The root coroutine
+    };
+
+    using const_iterator = iterator;
+
+    using iterator_category = std::input_iterator_tag;
+
+
+
+    Generator (Generator&& gen) noexcept : handle(std::exchange(gen.handle, {})) {}
+
+    Generator& operator = (Generator gen) noexcept
+    {
+        std::swap(handle, gen.handle);
+
+        return *this;
+    }
+
+    ~Generator ()
+    {
+        if(handle)
+            handle.destroy();
+    }
+
+
+    /// Runs the coroutine up to its first element. Must be called a single time
+    iterator begin () const
+    {
+        if(!handle)
+            return iterator();
+
+        resume(handle);
+
+        return iterator(handle);
+    }
+
+    iterator end () const { return iterator(); }
+
+
+private:
+
+    explicit Generator (handle_type handle) : handle(handle) {}
+
+
+    /// Resumes the innermost generator running, rethrowing the exceptions that reached the root
+    static void resume (handle_type root)
+    {
+        root.promise().active.resume();
+
+        if(root.done() && root.promise().exception)
+            std::rethrow_exception(std::exchange(root.promise().exception, nullptr));
+    }
+
+
+    handle_type handle;     ///< The coroutine
+};
+
+
+
+/** @brief Yields all the elements of the generator @p gen, in a <tt>co_yield handy::elementsOf(gen)</tt>
+
+    The elements of @p gen are given directly to the consumer, and its exceptions are thrown by the @c co_yield.
+*/
+template <typename T>
+impl::generator::ElementsOf<Generator<T>> elementsOf (Generator<T>&& gen)
+{
+    return impl::generator::ElementsOf<Generator<T>>{ std::move(gen) };
+}
+
+//@}
+
+} // namespace handy
+
+
+#endif // __cpp_impl_coroutine
+
+#endif // HANDY_RANGE_GENERATOR_H
@@ -0,0 +1,624 @@
+/** @file
+
+    @brief Cartesian product of ranges, traversed in row major, tiled or Morton (Z) order
+
+    handy::mrange() iterates over the tuples of elements of several random access ranges (handy::range(),
+    handy::linspace(), containers), replacing hand written nested loops. Integers are taken as
+    <tt>handy::range(n)</tt>:
+
+    @code{.cpp}
+    handy::Container<double, 0, 0> img(rows, cols);
+
+    for(auto [i, j] : handy::mrange(rows, cols))                 // Same as two nested loops
+        img(i, j) = f(i, j);
+
+    for(auto [i, j] : handy::mrange(rows, cols).tiled(32))       // 32x32 blocks, one after the other
+        out(j, i) = img(i, j);
+
+    for(auto [i, j] : handy::mrange(rows, cols).morton())        // Z order curve
+        g(img(i, j));
+    @endcode
+
+    Only the traversal changes, so the order of a loop is chosen by changing a single call:
+
+    - Row major (the default): the last range varies fastest. The iterator is random access.
+    - handy::MultiRange::tiled(): row major over tiles with the given number of elements per range,
+      and row major inside each tile. Tiles at the end of a range are shorter.
+    - handy::MultiRange::morton(): the bits of the position are interleaved between the ranges, so
+      neighbouring positions stay close in every dimension. Ranges whose size is not a power of two
+      are handled by skipping the positions outside of them.
+
+    For parallel loops, handy::MultiRange::tiles() is a random access range of the tiles, each one
+    a row major handy::MultiRange, that can be given to handy::parallelFor():
+
+    @code{.cpp}
+    handy::parallelFor(handy::mrange(rows, cols).tiled(64, 256).tiles(), [&](auto tile)
+    {
+        for(auto [i, j] : tile)
+            img(i, j) = f(i, j);
+    });
+    @endcode
+*/
+
+#ifndef HANDY_RANGE_MULTI_RANGE_H
+#define HANDY_RANGE_MULTI_RANGE_H
+
+#include "Range.h"
+
+#include <array>
+#include <tuple>
+#include <cstdint>
+
+
+namespace handy
+{
+
+/** @ingroup RangeGroup
+    @copydoc MultiRange.h
+*/
+//@{
+
+/// Traversal orders of a handy::MultiRange
+namespace order
+{
+
+/// The last range varies fastest, as in nested loops
+struct RowMajor {};
+
+/// Row major over tiles of @c tile elements of each range, and row major inside each tile
+template <std::size_t N>
+struct Tiled
+{
+    std::array<std::size_t, N> tile;    ///< Number of elements of each range in a tile
+};
+
+/// Z order curve, interleaving the bits of the positions of the ranges
+struct Morton {};
+
+} // namespace order
+
+
+
+namespace impl
+{
+
+namespace mrange
+{
+
+/// The positions <tt>[lo[d], lo[d] + ext[d])</tt> of each range @c d
+template <std::size_t N>
+struct Box
+{
+    /// Number of tuples of positions
+    std::size_t size () const
+    {
+        std::size_t res = 1;
+
+        for(auto e : ext)
+            res *= e;
+
+        return res;
+    }
+
+    std::array<std::size_t, N> lo;      ///< First position of each range
+    std::array<std::size_t, N> ext;     ///< Number of positions of each range
+};
+
+
+/// Number of tiles of each range
+template <std::size_t N>
+std::array<std::size_t, N> tileCounts (const Box<N>& box, const std::array<std::size_t, N>& tile)
+{
+    std::array<std::size_t, N> counts;
+
+    for(std::size_t d = 0; d < N; ++d)
+        counts[d] = (box.ext[d] + tile[d] - 1) / tile[d];
+
+    return counts;
+}
+
+/// The box of the tile @p k of @p box, in row major order of the tiles
+template <std::size_t N>
+Box<N> tileBox (const Box<N>& box, const std::array<std::size_t, N>& tile, std::size_t k)
+{
+    auto counts = tileCounts(box, tile);
+
+    Box<N> res;
+
+    for(std::size_t d = N; d-- > 0; k /= counts[d])
+    {
+        std::size_t offset = (k % counts[d]) * tile[d];
+
+        res.lo[d] = box.lo[d] + offset;
+        res.ext[d] = std::min(tile[d], box.ext[d] - offset);
+    }
+
+    return res;
+}
+
+
+/** @brief The state of a traversal order over a box: the current positions @c idx of the ranges
+
+    @c start(box, order, pos) goes to the tuple at position @p pos of the traversal, and
+    @c next(box, order) to the following one. Both are only called for positions inside the box.
+*/
+template <class Order, std::size_t N>
+struct Cursor;
+
+template <std::size_t N>
+struct Cursor<order::RowMajor, N>
+{
+    void start (const Box<N>& box, order::RowMajor, std::size_t pos)
+    {
+        for(std::size_t d = N; d-- > 0; pos /= box.ext[d])
+            idx[d] = box.lo[d] + pos % box.ext[d];
+    }
+
+    void next (const Box<N>& box, order::RowMajor)
+    {
+        for(std::size_t d = N; d-- > 0; idx[d] = box.lo[d])
+            if(++idx[d] < box.lo[d] + box.ext[d])
+                return;
+    }
+
+    std::array<std::size_t, N> idx;    ///< Current positions
+};
+
+
+template <std::size_t N>
+struct Cursor<order::Tiled<N>, N>
+{
+    void start (const Box<N>& box, const order::Tiled<N>& order, std::size_t pos)
+    {
+        tile = 0;
+        inner = tileBox(box, order.tile, tile);
+        idx = inner.lo;
+
+        while(pos--)
+            next(box, order);
+    }
+
+    void next (const Box<N>& box, const order::Tiled<N>& order)
+    {
+        for(std::size_t d = N; d-- > 0; idx[d] = inner.lo[d])
+            if(++idx[d] < inner.lo[d] + inner.ext[d])
+                return;
+
+        inner = tileBox(box, order.tile, ++tile);
+        idx = inner.lo;
+    }
+
+    std::array<std::size_t, N> idx;    ///< Current positions
+    std::size_t tile;                   ///< Index of the current tile
+    Box<N> inner;                       ///< The current tile
+};
+
+
+template <std::size_t N>
+struct Cursor<order::Morton, N>
+{
+    void start (const Box<N>& box, order::Morton, std::size_t pos)
+    {
+        std::array<unsigned, N> bits;
+
+        for(std::size_t d = 0; d < N; ++d)
+            for(bits[d] = 0; (std::size_t(1) << bits[d]) < box.ext[d]; ++bits[d]);
+
+        // The bits of the code go to the ranges in turn, from the last one, skipping the ranges without bits left
+        for(unsigned level = 0, j = 0; j < 64 && level < 64; ++level)
+            for(std::size_t d = N; d-- > 0;)
+                if(level < bits[d] && j < 64)
+                    dims[j] = std::uint8_t(d), shifts[j++] = std::uint8_t(level);
+
+        code = 0;
+        rel.fill(0);
+        idx = box.lo;
+
+        if(!inside(box))
+            next(box, order::Morton{});
+
+        while(pos--)
+            next(box, order::Morton{});
+    }
+
+    /// Increments the code until it is inside the box, flipping only the bits of the positions that change
+    void next (const Box<N>& box, order::Morton)
+    {
+        do
+        {
+            for(unsigned j = 0, carry = 1; carry; ++j)
+            {
+                carry = (code >> j) & 1;
+                rel[dims[j]] ^= std::size_t(1) << shifts[j];
+            }
+
+            ++code;
+
+        } while(!inside(box));
+
+        for(std::size_t d = 0; d < N; ++d)
+            idx[d] = box.lo[d] + rel[d];
+    }
+
+    bool inside (const Box<N>& box) const
+    {
+        for(std::size_t d = 0; d < N; ++d)
+            if(rel[d] >= box.ext[d])
+                return false;
+
+        return true;
+    }
+
+    std::array<std::size_t, N> idx;        ///< Current positions
+    std::array<std::size_t, N> rel;        ///< Current positions, relative to the box
+    std::array<std::uint8_t, 64> dims;      ///< The range of each bit of the code
+    std::array<std::uint8_t, 64> shifts;    ///< The bit of the position of its range for each bit of the code
+    std::uint64_t code;                     ///< Current Morton code
+};
+
+
+/// Random access iterator over an @p Owner with @c operator[], holding only the position
+template <class Owner>
+class IndexIterator
+{
+public:
+
+    using value_type        = typename Owner::value_type;
+    using reference         = value_type;
+    using pointer           = void;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+
+    IndexIterator (const Owner& owner, std::size_t pos) : owner(&owner), pos(pos) {}
+
+
+    reference operator * () const { return (*owner)[pos]; }
+
+    reference operator [] (difference_type inc) const { return (*owner)[pos + inc]; }
+
+
+    IndexIterator& operator ++ () { ++pos; return *this; }
+
+    IndexIterator& operator -- () { --pos; return *this; }
+
+    IndexIterator operator ++ (int) { IndexIterator temp{*this}; ++pos; return temp; }
+
+    IndexIterator operator -- (int) { IndexIterator temp{*this}; --pos; return temp; }
+
+    IndexIterator& operator += (difference_type inc) { pos += inc; return *this; }
+
+    IndexIterator& operator -= (difference_type inc) { pos -= inc; return *this; }
+
+    friend IndexIterator operator + (IndexIterator it, difference_type inc) { return it += inc; }
+
+    friend IndexIterator operator + (difference_type inc, IndexIterator it) { return it += inc; }
+
+    friend IndexIterator operator - (IndexIterator it, difference_type inc) { return it -= inc; }
+
+    friend difference_type operator - (const IndexIterator& it1, const IndexIterator& it2)
+    {
+        return difference_type(it1.pos) - difference_type(it2.pos);
+    }
+
+
+    friend bool operator == (const IndexIterator& it1, const IndexIterator& it2) { return it1.pos == it2.pos; }
+
+    friend bool operator != (const IndexIterator& it1, const IndexIterator& it2) { return it1.pos != it2.pos; }
+
+    friend bool operator <  (const IndexIterator& it1, const IndexIterator& it2) { return it1.pos < it2.pos; }
+
+    friend bool operator >  (const IndexIterator& it1, const IndexIterator& it2) { return it1.pos > it2.pos; }
+
+    friend bool operator <= (const IndexIterator& it1, const IndexIterator& it2) { return it1.pos <= it2.pos; }
+
+    friend bool operator >= (const IndexIterator& it1, const IndexIterator& it2) { return it1.pos >= it2.pos; }
+
+
+private:
+
+    const Owner* owner;     ///< The range
+    std::size_t pos;        ///< Position of the element
+};
+
+
+/// Integers become <tt>handy::range(n)</tt>, anything else is forwarded
+template <class R>
+decltype(auto) toRange (R&& r)
+{
+    if constexpr(std::is_arithmetic<std::decay_t<R>>::value)
+        return handy::range(r);
+
+    else
+        return std::forward<R>(r);
+}
+
+/// How a range is held: by reference if it is an lvalue, by value otherwise
+template <class R>
+using Stored = std::conditional_t<std::is_lvalue_reference<R>::value, R, std::decay_t<R>>;
+
+} // namespace mrange
+
+} // namespace impl
+
+
+
+/** @brief The Cartesian product of random access ranges, returned by handy::mrange()
+
+    @tparam Order One of handy::order
+    @tparam Ranges The ranges, references if they are held by reference. They must have @c size() and @c operator[]
+
+    The elements are tuples with the elements of the ranges. The iterator is random access for
+    handy::order::RowMajor, and forward otherwise.
+*/
+template <class Order, class... Ranges>
+class MultiRange
+{
+public:
+
+    /// Number of ranges
+    static constexpr std::size_t N = sizeof...(Ranges);
+
+    using Tuple = std::tuple<Ranges...>;
+
+    using Box = impl::mrange::Box<N>;
+
+    using reference = std::tuple<decltype(std::declval<const std::remove_reference_t<Ranges>&>()[0])...>;
+
+    using value_type = std::tuple<std::decay_t<decltype(std::declval<const std::remove_reference_t<Ranges>&>()[0])>...>;
+
+    static constexpr bool randomAccess = std::is_same<Order, order::RowMajor>::value;
+
+
+    /// Iterator holding the position and the state of the traversal
+    class iterator
+    {
+    public:
+
+        /** @name
+            @brief Some type definitions
+        */
+        //@{
+        using value_type        = MultiRange::value_type;
+        using reference         = MultiRange::reference;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::conditional_t<randomAccess, std::random_access_iterator_tag, std::forward_iterator_tag>;
+        //@}
+
+
+        iterator (const MultiRange& range, std::size_t pos) : range(&range) { seek(pos); }
+
+
+        reference operator * () const { return range->get(cursor.idx); }
+
+        reference operator [] (difference_type inc) const { return *(*this + inc); }
+
+
+        iterator& operator ++ ()
+        {
+            if(++pos < range->total)
+                cursor.next(range->box, range->order);
+
+            return *this;
+        }
+
+        iterator operator ++ (int) { iterator temp{*this}; ++*this; return temp; }
+
+        iterator& operator -- () { seek(pos - 1); return *this; }
+
+        iterator operator -- (int) { iterator temp{*this}; --*this; return temp; }
+
+        iterator& operator += (difference_type inc) { seek(pos + inc); return *this; }
+
+        iterator& operator -= (difference_type inc) { seek(pos - inc); return *this; }
+
+        friend iterator operator + (iterator it, difference_type inc) { return it += inc; }
+
+        friend iterator operator + (difference_type inc, iterator it) { return it += inc; }
+
+        friend iterator operator - (iterator it, difference_type inc) { return it -= inc; }
+
+        friend difference_type operator - (const iterator& it1, const iterator& it2)
+        {
+            return difference_type(it1.pos) - difference_type(it2.pos);
+        }
+
+
+        friend bool operator == (const iterator& it1, const iterator& it2) { return it1.pos == it2.pos; }
+
+        friend bool operator != (const iterator& it1, const iterator& it2) { return it1.pos != it2.pos; }
+
+        friend bool operator <  (const iterator& it1, const iterator& it2) { return it1.pos < it2.pos; }
+
+        friend bool operator >  (const iterator& it1, const iterator& it2) { return it1.pos > it2.pos; }
+
+        friend bool operator <= (const iterator& it1, const iterator& it2) { return it1.pos <= it2.pos; }
+
+        friend bool operator >= (const iterator& it1, const iterator& it2) { return it1.pos >= it2.pos; }
+
+
+    private:
+
+        /// Goes to the position @p p of the traversal
+        void seek (std::size_t p)
+        {
+            pos = p;
+
+            if(pos < range->total)
+                cursor.start(range->box, range->order, pos);
+        }
+
+
+        const MultiRange* range;                        ///< The ranges
+        std::size_t pos;                                ///< Position in the traversal
+        impl::mrange::Cursor<Order, N> cursor;          ///< State of the traversal
+    };
+
+    using const_iterator = iterator;
+
+    using iterator_category = typename iterator::iterator_category;
+
+
+
+    /// The tiles of a tiled handy::MultiRange, each one a row major handy::MultiRange
+    class Tiles
+    {
+    public:
+
+        using value_type = MultiRange<order::RowMajor, Ranges...>;
+
+        using iterator = impl::mrange::IndexIterator<Tiles>;
+
+        using const_iterator = iterator;
+
+
+        explicit Tiles (const MultiRange& whole) : whole(whole), counts(impl::mrange::tileCounts(whole.box, whole.order.tile)) {}
+
+
+        iterator begin () const { return iterator(*this, 0); }
+
+        iterator end () const { return iterator(*this, size()); }
+
+        /// Number of tiles
+        std::size_t size () const { return whole.total ? Box{ {}, counts }.size() : 0; }
+
+        /// The tile @p k, in row major order of the tiles
+        value_type operator [] (std::size_t k) const
+        {
+            return value_type(whole.ranges, order::RowMajor{}, impl::mrange::tileBox(whole.box, whole.order.tile, k));
+        }
+
+
+    private:
+
+        MultiRange whole;                       ///< The tiled range
+        std::array<std::size_t, N> counts;      ///< Number of tiles of each range
+    };
+
+
+
+    /// All the elements of the @p ranges, traversed in @p order
+    MultiRange (Tuple ranges, Order order) : MultiRange(std::move(ranges), order, Box{}, true) {}
+
+    /// The elements of the @p ranges at the positions of @p box, traversed in @p order
+    MultiRange (Tuple ranges, Order order, const Box& box) : MultiRange(std::move(ranges), order, box, false) {}
+
+
+    iterator begin () const { return iterator(*this, 0); }
+
+    iterator end () const { return iterator(*this, total); }
+
+    std::size_t size () const { return total; }
+
+    bool empty () const { return total == 0; }
+
+
+    /// The element at position @p pos of the row major traversal
+    template <bool R = randomAccess, std::enable_if_t<R>* = nullptr>
+    reference operator [] (std::size_t pos) const
+    {
+        return begin()[pos];
+    }
+
+
+    /** @brief The same ranges, traversed in tiles of @p tile elements of each range
+
+        A single size is used for all the ranges.
+    */
+    template <typename... Sizes>
+    auto tiled (Sizes... tile) const
+    {
+        static_assert(sizeof...(Sizes) == N || sizeof...(Sizes) == 1, "Give one tile size, or one per range");
+
+        order::Tiled<N> tiles;
+
+        if constexpr(sizeof...(Sizes) == 1)
+            tiles.tile.fill(std::size_t(tile)...);
+
+        else
+            tiles.tile = { std::size_t(tile)... };
+
+        for(auto& t : tiles.tile)
+            t = std::max<std::size_t>(t, 1);
+
+        return MultiRange<order::Tiled<N>, Ranges...>(ranges, tiles, box);
+    }
+
+    /// The same ranges, traversed in Morton (Z) order
+    auto morton () const
+    {
+        return MultiRange<order::Morton, Ranges...>(ranges, order::Morton{}, box);
+    }
+
+    /// The tiles of a range returned by #tiled(), as a random access range of row major handy::MultiRange
+    Tiles tiles () const
+    {
+        static_assert(std::is_same<Order, order::Tiled<N>>::value, "Only a handy::MultiRange returned by tiled() has tiles");
+
+        return Tiles(*this);
+    }
+
+
+private:
+
+    MultiRange (Tuple ranges, Order order, Box b, bool whole) : ranges(std::move(ranges)), order(order), box(b)
+    {
+        if(whole)
+            box = sizes(std::make_index_sequence<N>());
+
+        total = box.size();
+    }
+
+
+    /// The box with all the positions of the ranges
+    template <std::size_t... Is>
+    Box sizes (std::index_sequence<Is...>) const
+    {
+        return Box{ {}, { std::size_t(std::size(std::get<Is>(ranges)))... } };
+    }
+
+
+    /// The elements of the ranges at the positions @p idx
+    reference get (const std::array<std::size_t, N>& idx) const
+    {
+        return get(idx, std::make_index_sequence<N>());
+    }
+
+    template <std::size_t... Is>
+    reference get (const std::array<std::size_t, N>& idx, std::index_sequence<Is...>) const
+    {
+        return reference(std::get<Is>(ranges)[idx[Is]]...);
+    }
+
+
+    Tuple ranges;           ///< The ranges
+
+    Order order;            ///< The traversal order
+
+    Box box;                ///< The positions of the ranges traversed
+
+    std::size_t total;      ///< Number of elements
+};
+
+
+
+/** @brief Returns the Cartesian product of the @p ranges, in row major order
+
+    @param ranges Random access ranges with @c size(), or integers @c n, taken as <tt>handy::range(n)</tt>.
+                  Lvalues are held by reference
+*/
+template <class... Rs>
+auto mrange (Rs&&... ranges)
+{
+    using Multi = MultiRange<order::RowMajor, impl::mrange::Stored<decltype(impl::mrange::toRange(std::forward<Rs>(ranges)))>...>;
+
+    return Multi(typename Multi::Tuple(impl::mrange::toRange(std::forward<Rs>(ranges))...), order::RowMajor{});
+}
+
+//@}
+
+} // namespace handy
+
+
+#endif // HANDY_RANGE_MULTI_RANGE_H
@@ -0,0 +1,246 @@
+/** @file
+
+    @brief Parallel loops over a handy::Range, with OpenMP like schedules
+
+    handy::parallelFor() calls a function for every element of a random access range (usually a
+    handy::range() of integrals), splitting the elements between the threads of handy::threadPool():
+
+    @code{.cpp}
+    handy::parallelFor(handy::range(0, n), [&](int i){ y[i] = f(x[i]); });
+
+    handy::parallelFor(handy::range(0, n, 2), [&](int i){ heavy(i); }, handy::schedule::Dynamic{16});
+
+    double sum = handy::parallelFor(handy::range(n), handy::reduction(0.0), [&](int i, double& acc)
+    {
+        acc += x[i] * y[i];
+    });
+    @endcode
+
+    The schedules are the same as the OpenMP ones:
+
+    - handy::schedule::Static: one contiguous block per thread, or blocks of a given chunk size assigned
+      round-robin to the threads, the block @c k going with the blocks <tt>k + threads</tt>, <tt>k + 2 threads</tt>...
+    - handy::schedule::Dynamic: blocks of a given chunk size, taken by the threads as they finish the previous ones
+    - handy::schedule::Guided: blocks getting smaller, proportional to the number of remaining elements
+      divided by the number of threads, down to a minimum chunk size
+
+    With a handy::reduction(), each block accumulates into its own value, starting from the initial
+    value, and the values of all blocks are combined in order at the end. So the result depends only
+    on the blocks (fixed by the schedule and the size of the pool), never on which thread executed
+    which block.
+*/
+
+#ifndef HANDY_RANGE_PARALLEL_H
+#define HANDY_RANGE_PARALLEL_H
+
+#include "Range.h"
+#include "../Helpers/Parallel.h"
+
+#include <functional>
+
+
+namespace handy
+{
+
+/** @ingroup RangeGroup
+    @copydoc Range/Parallel.h
+*/
+//@{
+
+/// Schedules of handy::parallelFor()
+namespace schedule
+{
+
+/// One contiguous block per thread. If @c chunk is not zero, blocks of @c chunk elements, assigned round-robin to the threads
+struct Static
+{
+    std::size_t chunk = 0;  ///< Number of elements of each block
+};
+
+/// Blocks of @c chunk elements, taken by the threads in order as they become free
+struct Dynamic
+{
+    std::size_t chunk = 1;  ///< Number of elements of each block
+};
+
+/// Blocks proportional to the remaining elements divided by the number of threads, with at least @c chunk elements
+struct Guided
+{
+    std::size_t chunk = 1;  ///< Minimum number of elements of each block
+};
+
+} // namespace schedule
+
+
+
+/// An initial value and an associative operation, for handy::parallelFor() to reduce
+template <typename T, class Op>
+struct Reduction
+{
+    T init;     ///< The initial value of each block, which must be an identity of #op
+    Op op;      ///< The associative operation combining the values of the blocks
+};
+
+/// Creates a handy::Reduction
+template <typename T, class Op = std::plus<>>
+Reduction<T, Op> reduction (T init, Op op = Op())
+{
+    return Reduction<T, Op>{ init, op };
+}
+
+
+
+namespace impl
+{
+
+namespace parallel
+{
+
+/** @name
+    @brief The boundaries of the blocks of @p n elements for each schedule
+
+    The block @c k goes from <tt>bounds[k]</tt> to <tt>bounds[k + 1]</tt>.
+*/
+//@{
+inline std::vector<std::size_t> bounds (std::size_t n, schedule::Static s)
+{
+    std::size_t blocks = s.chunk ? (n + s.chunk - 1) / s.chunk : std::min(n, threadPool().size());
+
+    std::vector<std::size_t> res(blocks + 1, 0);
+
+    for(std::size_t k = 1; k <= blocks; ++k)
+        res[k] = s.chunk ? std::min(n, k * s.chunk) : n * k / blocks;
+
+    return res;
+}
+
+inline std::vector<std::size_t> bounds (std::size_t n, schedule::Dynamic s)
+{
+    return bounds(n, schedule::Static{ std::max<std::size_t>(s.chunk, 1) });
+}
+
+inline std::vector<std::size_t> bounds (std::size_t n, schedule::Guided s)
+{
+    std::vector<std::size_t> res{ 0 };
+
+    std::size_t threads = threadPool().size(), chunk = std::max<std::size_t>(s.chunk, 1);
+
+    for(std::size_t b = 0; b < n; res.push_back(b))
+        b += std::min(n - b, std::max(chunk, (n - b) / (2 * threads)));
+
+    return res;
+}
+//@}
+
+
+/** @name
+    @brief Number of tasks of the thread pool executing @p blocks blocks with each schedule
+
+    With the static schedule, there is at most one task per thread, and the task @c t executes the blocks
+    <tt>t, t + tasks, t + 2 tasks...</tt>, fixed in advance. With the others, each block is a task, taken
+    by the threads as they become free.
+*/
+//@{
+inline std::size_t numTasks (std::size_t blocks, schedule::Static)
+{
+    return std::min(blocks, threadPool().size());
+}
+
+template <class Schedule>
+std::size_t numTasks (std::size_t blocks, Schedule)
+{
+    return blocks;
+}
+//@}
+
+
+/// Calls @p f(k) for every block @c k of the @p blocks, split between the threads as told by the schedule @p s
+template <class Schedule, class F>
+void runBlocks (std::size_t blocks, Schedule s, F&& f)
+{
+    std::size_t tasks = numTasks(blocks, s);
+
+    threadPool().run(tasks, [&](std::size_t t)
+    {
+        for(std::size_t k = t; k < blocks; k += tasks)
+            f(k);
+    });
+}
+
+
+/// The value of a block, padded to a cache line so the blocks never write to the same line
+template <typename T>
+struct alignas(64) Padded
+{
+    T value;
+};
+
+} // namespace parallel
+
+} // namespace impl
+
+
+
+/** @brief Calls @p f with every element of @p range, in parallel
+
+    @param range A random access range with @c size(), as a finite handy::range() of integrals
+    @param f The function, taking an element of the range. Must be safe to call concurrently
+    @param s The schedule, one of handy::schedule
+
+    If @p f throws, the blocks not started are skipped, and the first exception is rethrown.
+*/
+template <class R, class F, class Schedule = schedule::Static>
+void parallelFor (const R& range, F f, Schedule s = Schedule())
+{
+    auto first = std::begin(range);
+
+    auto bounds = impl::parallel::bounds(std::size(range), s);
+
+    impl::parallel::runBlocks(bounds.size() - 1, s, [&](std::size_t k)
+    {
+        for(std::size_t i = bounds[k]; i < bounds[k + 1]; ++i)
+            f(first[i]);
+    });
+}
+
+
+/** @brief Calls @p f with every element of @p range and the accumulator of its block, in parallel, returning the reduction
+
+    @param range A random access range with @c size(), as a finite handy::range() of integrals
+    @param red The initial value and the operation of the reduction
+    @param f The function, taking an element of the range and a reference to the accumulator
+    @param s The schedule, one of handy::schedule
+
+    @return The initial value combined, in order, with the accumulators of all the blocks
+*/
+template <class R, typename T, class Op, class F, class Schedule = schedule::Static>
+T parallelFor (const R& range, Reduction<T, Op> red, F f, Schedule s = Schedule())
+{
+    auto first = std::begin(range);
+
+    auto bounds = impl::parallel::bounds(std::size(range), s);
+
+    std::vector<impl::parallel::Padded<T>> partial(bounds.size() - 1, { red.init });
+
+    impl::parallel::runBlocks(partial.size(), s, [&](std::size_t k)
+    {
+        T& acc = partial[k].value;
+
+        for(std::size_t i = bounds[k]; i < bounds[k + 1]; ++i)
+            f(first[i], acc);
+    });
+
+    T res = red.init;
+
+    for(const auto& p : partial)
+        res = red.op(res, p.value);
+
+    return res;
+}
+
+//@}
+
+} // namespace handy
+
+
+#endif // HANDY_RANGE_PARALLEL_H
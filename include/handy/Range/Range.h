@@ -19,6 +19,15 @@
     For infinite intervals you need, of course, stop the loop at some point:
 
     @snippet Range/RangeExample.cpp Infinite Range Snippet
+
+    Finite ranges of arithmetic types compute each element from its position, as <tt>first + i * step</tt>,
+    so floating point ranges do not accumulate rounding errors, and they are random access. For a fixed
+    number of points between two values, handy::linspace() also hits the last value exactly:
+
+    @code{.cpp}
+    for(double x : handy::linspace(0.0, 1.0, 11))   // 0.0, 0.1, ..., 1.0
+        f(x);
+    @endcode
 */
 
 #ifndef HANDY_RANGE_H
@@ -29,6 +38,8 @@
 #include <iterator>
 #include <vector>
 #include <cmath>
+#include <limits>
+#include <algorithm>
 
 
 /** @defgroup RangeGroup Range utilities
@@ -118,6 +129,8 @@ public:
     //@{
     class Iterator;
 
+    class CountedIterator;
+
     friend Iterator;
 
 
@@ -125,7 +138,10 @@ public:
 
     using value_type = Type;
 
-    using iterator = Iterator;
+    /// If the number of elements is computed in closed form, so the iterator is a random access CountedIterator
+    static constexpr bool counted = std::is_arithmetic<Type>::value && !std::is_same<ValidRange, impl::InfiniteInterval>::value;
+
+    using iterator = std::conditional_t<counted, CountedIterator, Iterator>;
 
     using iterator_category = typename iterator::iterator_category;
 
@@ -230,22 +246,167 @@ public:
 
 
 
+    /** @brief Random access iterator for finite ranges of arithmetic types
+
+        It holds only the position @c i of the element, whose value is <tt>first + i * step</tt>. So
+        the distance, the comparisons and the access at any position take constant time.
+    */
+    class CountedIterator
+    {
+    public:
+
+        /** @name
+            @brief Some type definitions
+        */
+        //@{
+        using value_type        = Type;
+        using reference         = Type;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+        //@}
+
+
+        /** @brief Constructor for Range::CountedIterator
+
+            @param range A constant reference to a Range class
+            @param pos The position of the element
+        */
+        CountedIterator (const Range& range, difference_type pos) : first(range.first), step(range.step), pos(pos) {}
+
+
+        /** @name
+            @brief The operators for a random access iterator
+        */
+        //@{
+        reference operator * () const { return Range::at(first, step, pos); }
+
+        reference operator [] (difference_type inc) const { return Range::at(first, step, pos + inc); }
+
+
+        CountedIterator& operator ++ () { ++pos; return *this; }
+
+        CountedIterator& operator -- () { --pos; return *this; }
+
+        CountedIterator operator ++ (int) { CountedIterator temp{*this}; ++pos; return temp; }
+
+        CountedIterator operator -- (int) { CountedIterator temp{*this}; --pos; return temp; }
+
+        CountedIterator& operator += (difference_type inc) { pos += inc; return *this; }
+
+        CountedIterator& operator -= (difference_type inc) { pos -= inc; return *this; }
+
+        friend CountedIterator operator + (CountedIterator it, difference_type inc) { return it += inc; }
+
+        friend CountedIterator operator + (difference_type inc, CountedIterator it) { return it += inc; }
+
+        friend CountedIterator operator - (CountedIterator it, difference_type inc) { return it -= inc; }
+
+        friend difference_type operator - (const CountedIterator& it1, const CountedIterator& it2) { return it1.pos - it2.pos; }
+
+
+        friend bool operator == (const CountedIterator& it1, const CountedIterator& it2) { return it1.pos == it2.pos; }
+
+        friend bool operator != (const CountedIterator& it1, const CountedIterator& it2) { return it1.pos != it2.pos; }
+
+        friend bool operator <  (const CountedIterator& it1, const CountedIterator& it2) { return it1.pos < it2.pos; }
+
+        friend bool operator >  (const CountedIterator& it1, const CountedIterator& it2) { return it1.pos > it2.pos; }
+
+        friend bool operator <= (const CountedIterator& it1, const CountedIterator& it2) { return it1.pos <= it2.pos; }
+
+        friend bool operator >= (const CountedIterator& it1, const CountedIterator& it2) { return it1.pos >= it2.pos; }
+        //@}
+
+
+    private:
+
+        Type first;             ///< First element of the range
+
+        Type step;              ///< Step between elements of the range
+
+        difference_type pos;    ///< Position of the element
+    };
+
+
+
     /** @name
         @brief #begin() and #end() definitions
     */
     //@{
-    iterator begin() { return iterator(*this, first); }
-
-    iterator end() { return iterator(*this, last); }
+    iterator begin() const
+    {
+        if constexpr(counted)
+            return iterator(*this, 0);
 
+        else
+            return iterator(*this, first);
+    }
 
-    const_iterator begin() const { return const_iterator(*this, first); }
+    iterator end() const
+    {
+        if constexpr(counted)
+            return iterator(*this, std::ptrdiff_t(size()));
 
-    const_iterator end() const { return const_iterator(*this, last); }
+        else
+            return iterator(*this, last);
+    }
     //@}
 
 
-    
+
+    /** @brief Number of elements of the range, computed in closed form
+
+        For floating point types, a number of steps between @c first and @c last that is within a few
+        ulps of an integer is rounded to it, so the rounding of @c step never adds or drops the last point.
+
+        @note Only available for finite ranges of arithmetic types
+    */
+    template <bool C = counted, std::enable_if_t<C>* = nullptr>
+    std::size_t size () const
+    {
+        constexpr bool closed = std::is_same<ValidRange, impl::ClosedInterval>::value;
+
+        bool valid = step > Type{0} ? (closed ? first <= last : first < last) :
+                     step < Type{0} ? (closed ? last <= first : last < first) : false;
+
+        if(!valid)
+            return 0;
+
+        if constexpr(std::is_integral<Type>::value)
+        {
+            using U = std::make_unsigned_t<std::common_type_t<Type, int>>;
+
+            U dist = step > Type{0} ? U(last) - U(first) : U(first) - U(last);
+            U absStep = step > Type{0} ? U(step) : U(0) - U(step);
+
+            return std::size_t(dist / absStep) + (closed || dist % absStep != 0);
+        }
+
+        else
+        {
+            Type count = (last - first) / step, nearest = std::round(count);
+
+            // A count a few ulps away from an integer is the integer: 'crange(0.0, 0.3, 0.1)' has the last point
+            if(std::abs(count - nearest) <= 4 * std::numeric_limits<Type>::epsilon() * std::max<Type>(1, std::abs(nearest)))
+                count = nearest;
+
+            return closed ? std::size_t(std::floor(count)) + 1 : std::size_t(std::ceil(count));
+        }
+    }
+
+    /** @brief The element at position @p pos, <tt>first + pos * step</tt>
+
+        @note Only available for finite ranges of arithmetic types
+    */
+    template <bool C = counted, std::enable_if_t<C>* = nullptr>
+    Type operator [] (std::size_t pos) const
+    {
+        return at(first, step, pos);
+    }
+
+
+
     /** @brief Evaluates a range into a std::vector
         
         @note Only available if the range is not infinite
@@ -253,27 +414,49 @@ public:
         @return A std::vector with the evaluated range   
     */
     template <typename U = ValidRange, std::enable_if_t<!std::is_same<U, impl::InfiniteInterval>::value>* = nullptr>
-    std::vector<Type> eval ()
+    std::vector<Type> eval () const
     {
-        std::vector<Type> evaluated;
+        if constexpr(counted)
+        {
+            std::vector<Type> evaluated(size());
 
-        evaluated.reserve(std::ceil((last - first) / step));
+            eval(evaluated.begin());
 
-        eval(std::back_inserter(evaluated));
+            return evaluated;
+        }
 
-        return evaluated;
+        else
+        {
+            std::vector<Type> evaluated;
+
+            eval(std::back_inserter(evaluated));
+
+            return evaluated;
+        }
     }
 
     /** @brief Evaluates a range into the given iterator
 
+        For arithmetic types, each element is computed from its position alone, so the loop over
+        contiguous memory has no dependency between iterations, being easily vectorized.
+
         @note Only available if the range is not infinite
 
         @param iter The iterator to copy the range
     */
     template <typename Iter, typename U = ValidRange, std::enable_if_t<!std::is_same<U, impl::InfiniteInterval>::value>* = nullptr>
-    void eval (Iter iter)
+    void eval (Iter iter) const
     {
-        std::copy(this->begin(), this->end(), iter);
+        if constexpr(counted)
+        {
+            std::size_t n = size();
+
+            for(std::size_t i = 0; i < n; ++i, ++iter)
+                *iter = at(first, step, i);
+        }
+
+        else
+            std::copy(this->begin(), this->end(), iter);
     }
 
 
@@ -281,6 +464,21 @@ public:
 
 protected:
 
+    /// The element at position @p pos. Integrals are computed in unsigned arithmetic, so no intermediate value overflows
+    static Type at (const Type& first, const Type& step, std::size_t pos)
+    {
+        if constexpr(std::is_integral<Type>::value && !std::is_same<Type, bool>::value)
+        {
+            using U = std::make_unsigned_t<std::common_type_t<Type, int>>;
+
+            return Type(U(first) + U(pos) * U(step));
+        }
+
+        else
+            return first + Type(pos) * step;
+    }
+
+
     Type first;     ///< First element of the range
 
     Type last;      ///< Last element of the range
@@ -391,6 +589,185 @@ static decltype(auto) irange ()
 	return Range<int, impl::InfiniteInterval>(0, 0, 1);
 }
 //@}
+
+
+
+/** @brief A fixed number of evenly spaced points between two values, as numpy's @c linspace
+
+    The element @c i is <tt>first + i * step</tt>, and the last one is exactly @c last if the end point
+    is included. Each element depends only on its position, so the iterator is random access, loops
+    over it are vectorizable, and splitting it between threads gives the same values as a serial loop.
+
+    @tparam T A floating point type
+*/
+template <typename T>
+class Linspace
+{
+public:
+
+    using Type = T;
+
+    using value_type = Type;
+
+
+    /** @brief Random access iterator over the points of a Linspace
+
+        It holds a copy of the Linspace, so it never refers to a temporary one.
+    */
+    class iterator
+    {
+    public:
+
+        /** @name
+            @brief Some type definitions
+        */
+        //@{
+        using value_type        = Type;
+        using reference         = Type;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+        //@}
+
+
+        iterator (const Linspace& space, difference_type pos) : space(space), pos(pos) {}
+
+
+        /** @name
+            @brief The operators for a random access iterator
+        */
+        //@{
+        reference operator * () const { return space[pos]; }
+
+        reference operator [] (difference_type inc) const { return space[pos + inc]; }
+
+
+        iterator& operator ++ () { ++pos; return *this; }
+
+        iterator& operator -- () { --pos; return *this; }
+
+        iterator operator ++ (int) { iterator temp{*this}; ++pos; return temp; }
+
+        iterator operator -- (int) { iterator temp{*this}; --pos; return temp; }
+
+        iterator& operator += (difference_type inc) { pos += inc; return *this; }
+
+        iterator& operator -= (difference_type inc) { pos -= inc; return *this; }
+
+        friend iterator operator + (iterator it, difference_type inc) { return it += inc; }
+
+        friend iterator operator + (difference_type inc, iterator it) { return it += inc; }
+
+        friend iterator operator - (iterator it, difference_type inc) { return it -= inc; }
+
+        friend difference_type operator - (const iterator& it1, const iterator& it2) { return it1.pos - it2.pos; }
+
+
+        friend bool operator == (const iterator& it1, const iterator& it2) { return it1.pos == it2.pos; }
+
+        friend bool operator != (const iterator& it1, const iterator& it2) { return it1.pos != it2.pos; }
+
+        friend bool operator <  (const iterator& it1, const iterator& it2) { return it1.pos < it2.pos; }
+
+        friend bool operator >  (const iterator& it1, const iterator& it2) { return it1.pos > it2.pos; }
+
+        friend bool operator <= (const iterator& it1, const iterator& it2) { return it1.pos <= it2.pos; }
+
+        friend bool operator >= (const iterator& it1, const iterator& it2) { return it1.pos >= it2.pos; }
+        //@}
+
+
+    private:
+
+        Linspace space;         ///< The points
+
+        difference_type pos;    ///< Position of the point
+    };
+
+    using const_iterator = iterator;
+
+    using iterator_category = std::random_access_iterator_tag;
+
+
+
+    /** @brief @p n points from @p first to @p last
+
+        @param endpoint If @p last is the last point. Otherwise, the points are the first @p n of <tt>n + 1</tt>.
+                        A single point is always @p first
+    */
+    Linspace (const Type& first, const Type& last, std::size_t n, bool endpoint = true) :
+              first(first), last(last), step(n > endpoint ? (last - first) / Type(n - endpoint) : Type{0}),
+              n(n), endpoint(endpoint) {}
+
+
+    iterator begin () const { return iterator(*this, 0); }
+
+    iterator end () const { return iterator(*this, std::ptrdiff_t(n)); }
+
+    std::size_t size () const { return n; }
+
+    bool empty () const { return n == 0; }
+
+
+    /// The point at position @p pos
+    Type operator [] (std::size_t pos) const
+    {
+        return endpoint && pos && pos + 1 == n ? last : first + Type(pos) * step;
+    }
+
+
+    /// Evaluates the points into a std::vector
+    std::vector<Type> eval () const
+    {
+        std::vector<Type> evaluated(n);
+
+        eval(evaluated.begin());
+
+        return evaluated;
+    }
+
+    /// Evaluates the points into the given iterator
+    template <typename Iter>
+    void eval (Iter iter) const
+    {
+        for(std::size_t i = 0; i < n; ++i, ++iter)
+            *iter = (*this)[i];
+    }
+
+
+private:
+
+    Type first;     ///< First point
+
+    Type last;      ///< Last point
+
+    Type step;      ///< Step between points
+
+    std::size_t n;  ///< Number of points
+
+    bool endpoint;  ///< If @c last is the last point
+};
+
+
+/** @brief Returns a Linspace of @p n points from @p first to @p last
+
+    The type is the common type of @p First and @p Last, or @c double if it is integral.
+
+    @param first First point
+    @param last Last point, included if @p endpoint
+    @param n Number of points
+    @param endpoint If @p last is included
+*/
+template <typename First, typename Last>
+decltype(auto) linspace (const First& first, const Last& last, std::size_t n, bool endpoint = true)
+{
+    using Common = std::decay_t<std::common_type_t<First, Last>>;
+
+    using Type = std::conditional_t<std::is_floating_point<Common>::value, Common, double>;
+
+    return Linspace<Type>(first, last, n, endpoint);
+}
+
 //@}
 
 }	// namespace handy
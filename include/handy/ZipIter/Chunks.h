@@ -0,0 +1,304 @@
+/** @file
+
+    @brief Iteration over blocks of consecutive elements of a container or of a handy::Zip
+
+    handy::chunks() splits a range into sub ranges of @c n elements (the last one may be shorter), so
+    batch kernels and parallel tasks get whole blocks instead of single elements:
+
+    @code{.cpp}
+    std::vector<Row> rows = ...;
+
+    for(auto block : handy::chunks(rows, 1000))
+        database.insert(block.begin(), block.end());
+
+    for(auto block : handy::chunks(handy::zip(keys, values), 256))
+        for(auto&& [k, v] : block)
+            v += k;
+
+    handy::forEach(handy::par, handy::chunks(data, 4096), [](auto block){ process(block); });
+    @endcode
+
+    The bounds of the chunks are computed from their index, so for random access ranges each one costs
+    a couple of arithmetic operations, and the chunks themselves are random access.
+
+    handy::alignedChunks() also places the chunk boundaries at cache line boundaries of the first
+    container, when its memory is known and @c n elements fill whole cache lines. For that, the first
+    chunk is shortened to end at the first aligned element.
+*/
+
+#ifndef HANDY_ZIP_ITER_CHUNKS_H
+#define HANDY_ZIP_ITER_CHUNKS_H
+
+#include "ZipIter.h"
+
+#include <cstdint>
+
+
+namespace handy
+{
+
+/** @ingroup ZipIterGroup
+    @copydoc Chunks.h
+*/
+//@{
+
+/// A sub range <tt>[first, last)</tt> of a range
+template <typename Iter>
+class Subrange
+{
+public:
+
+    using iterator = Iter;
+    using const_iterator = Iter;
+    using value_type = typename std::iterator_traits<Iter>::value_type;
+
+
+    Subrange (Iter first, Iter last, std::size_t n) : first(first), last(last), n(n) {}
+
+
+    Iter begin () const { return first; }
+
+    Iter end () const { return last; }
+
+    std::size_t size () const { return n; }
+
+    bool empty () const { return n == 0; }
+
+    /// Element at position @p pos, for random access ranges
+    decltype(auto) operator [] (std::size_t pos) const { return first[pos]; }
+
+
+private:
+
+    Iter first;         ///< The first element
+    Iter last;          ///< One past the last element
+    std::size_t n;      ///< The number of elements
+};
+
+
+
+/** @brief The range of chunks of @c n elements of a range, returned by handy::chunks() and handy::alignedChunks()
+
+    The boundary of the chunk @c k is <tt>k * n - offset</tt>, clamped to <tt>[0, size]</tt>. The offset
+    is zero for handy::chunks(), and shortens the first chunk in handy::alignedChunks().
+
+    The iterator has the same category as @p Iter (at least forward). Dereferencing gives a handy::Subrange.
+*/
+template <typename Iter>
+class Chunks
+{
+public:
+
+    /// The iterator over the chunks
+    class iterator
+    {
+    public:
+
+        using value_type = Subrange<Iter>;
+        using reference = value_type;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = typename std::iterator_traits<Iter>::iterator_category;
+
+        static constexpr bool randomAccess = std::is_same<iterator_category, std::random_access_iterator_tag>::value;
+
+
+        iterator (const Chunks& chunks, std::size_t k) : chunks(&chunks), k(k), cur(chunks.at(k)), next(chunks.at(k + 1)) {}
+
+
+        value_type operator * () const { return value_type(cur, next, chunks->bound(k + 1) - chunks->bound(k)); }
+
+        value_type operator [] (difference_type inc) const { return *(*this + inc); }
+
+
+        iterator& operator ++ ()
+        {
+            ++k;
+
+            if constexpr(randomAccess)
+                return *this = iterator(*chunks, k);
+
+            cur = next;
+            next = std::next(cur, chunks->bound(k + 1) - chunks->bound(k));
+
+            return *this;
+        }
+
+        iterator operator ++ (int) { iterator temp{*this}; ++*this; return temp; }
+
+        iterator& operator -- () { return *this = iterator(*chunks, k - 1); }
+
+        iterator operator -- (int) { iterator temp{*this}; --*this; return temp; }
+
+        iterator& operator += (difference_type inc) { return *this = iterator(*chunks, k + inc); }
+
+        iterator& operator -= (difference_type inc) { return *this = iterator(*chunks, k - inc); }
+
+        friend iterator operator + (iterator iter, difference_type inc) { return iter += inc; }
+
+        friend iterator operator + (difference_type inc, iterator iter) { return iter += inc; }
+
+        friend iterator operator - (iterator iter, difference_type inc) { return iter -= inc; }
+
+        friend difference_type operator - (const iterator& iter1, const iterator& iter2)
+        {
+            return difference_type(iter1.k) - difference_type(iter2.k);
+        }
+
+
+        friend bool operator == (const iterator& iter1, const iterator& iter2) { return iter1.k == iter2.k; }
+
+        friend bool operator != (const iterator& iter1, const iterator& iter2) { return iter1.k != iter2.k; }
+
+        friend bool operator <  (const iterator& iter1, const iterator& iter2) { return iter1.k < iter2.k; }
+
+        friend bool operator >  (const iterator& iter1, const iterator& iter2) { return iter1.k > iter2.k; }
+
+        friend bool operator <= (const iterator& iter1, const iterator& iter2) { return iter1.k <= iter2.k; }
+
+        friend bool operator >= (const iterator& iter1, const iterator& iter2) { return iter1.k >= iter2.k; }
+
+
+    private:
+
+        const Chunks* chunks;   ///< The chunks
+        std::size_t k;          ///< Index of the chunk
+
+        Iter cur;               ///< Begin of the chunk
+        Iter next;              ///< End of the chunk
+    };
+
+    using const_iterator = iterator;
+
+    using value_type = Subrange<Iter>;
+
+
+
+    /** @brief Chunks of @p n elements of the range of @p size elements starting at @p first
+
+        @param offset Number of elements the first chunk is shorter. Must be smaller than @p n
+    */
+    Chunks (Iter first, std::size_t size, std::size_t n, std::size_t offset = 0) :
+            first(first), total(size), n(std::max<std::size_t>(n, 1)), offset(offset) {}
+
+
+    /// Number of chunks
+    std::size_t size () const { return total ? (total + offset + n - 1) / n : 0; }
+
+    bool empty () const { return total == 0; }
+
+
+    /// Position of the first element of the chunk @p k, which goes up to <tt>bound(k + 1)</tt>
+    std::size_t bound (std::size_t k) const
+    {
+        return k == 0 ? 0 : std::min(total, k * n - offset);
+    }
+
+
+    iterator begin () const { return iterator(*this, 0); }
+
+    iterator end () const { return iterator(*this, size()); }
+
+    /// The chunk @p k
+    value_type operator [] (std::size_t k) const { return *iterator(*this, k); }
+
+
+
+private:
+
+    /// Iterator to the first element of the chunk @p k. Only called for the neighbouring chunks of non random access ranges
+    Iter at (std::size_t k) const
+    {
+        return std::next(first, bound(std::min(k, size())));
+    }
+
+
+    Iter first;             ///< The first element of the range
+    std::size_t total;      ///< Number of elements of the range
+    std::size_t n;          ///< Number of elements of each chunk
+    std::size_t offset;     ///< How many elements shorter the first chunk is
+};
+
+
+
+namespace impl
+{
+
+namespace zip
+{
+
+/// Pointer to the memory of the first container of a range, if known
+template <class Range>
+auto firstData (Range& range)
+{
+    using Iter = decltype(std::begin(range));
+
+    if constexpr(HasData<Range>::value)
+        return range.data();
+
+    else if constexpr(IsSpecialization<Iter, CountedZipIter>::value)
+        return std::get<0>(std::begin(range).bases());
+
+    else
+        return nullptr;
+}
+
+
+/** @name
+    @brief Number of elements the first chunk must be shorter so the others start at a cache line boundary
+*/
+//@{
+template <typename Iter>
+std::size_t alignmentOffset (const Iter&, std::size_t)
+{
+    return 0;
+}
+
+template <typename T>
+std::size_t alignmentOffset (T* data, std::size_t n)
+{
+    constexpr std::size_t lineSize = 64;
+
+    if(sizeof(T) >= lineSize || lineSize % sizeof(T) || (n * sizeof(T)) % lineSize)
+        return 0;
+
+    std::size_t head = ((lineSize - std::uintptr_t(data) % lineSize) % lineSize) / sizeof(T);
+
+    return (n - head % n) % n;
+}
+//@}
+
+} // namespace zip
+
+} // namespace impl
+
+
+
+/** @brief Splits @p range (a container or a handy::Zip) into chunks of @p n elements
+
+    The range must outlive the chunks, except for a handy::Zip of random access containers, whose
+    iterators do not refer to the Zip itself.
+*/
+template <class Range>
+auto chunks (Range&& range, std::size_t n)
+{
+    return Chunks<decltype(std::begin(range))>(std::begin(range), std::size(range), n);
+}
+
+
+/** @brief Splits @p range into chunks of @p n elements, starting at cache line boundaries
+    @copydetails chunks()
+*/
+template <class Range>
+auto alignedChunks (Range&& range, std::size_t n)
+{
+    return Chunks<decltype(std::begin(range))>(std::begin(range), std::size(range), n,
+                                               impl::zip::alignmentOffset(impl::zip::firstData(range), n));
+}
+
+//@}
+
+} // namespace handy
+
+
+#endif // HANDY_ZIP_ITER_CHUNKS_H
@@ -0,0 +1,284 @@
+/** @file
+
+    @brief Conversion between a range of tuples (rows) and one container per element (columns)
+
+    handy::unzipInto() writes each element of the tuples of a range into its own output container, and
+    handy::zipInto() does the reverse, building a container of tuples (or structs) from the columns:
+
+    @code{.cpp}
+    std::vector<std::tuple<int, std::string, double>> rows = query();
+
+    std::vector<int> ids;
+    std::vector<std::string> names;
+    std::vector<double> prices;
+
+    handy::unzipInto(std::move(rows), ids, names, prices);   // The strings are moved out of the rows
+
+    std::vector<std::pair<int, double>> pairs;
+
+    handy::zipInto(pairs, ids, prices);
+    @endcode
+
+    Outputs with @c push_back() are appended to, and grow a single time by the number of elements of the
+    input. The others (arrays, handy::Container, ...) are written from their beginning and must be large
+    enough. If the input and all the outputs are random access, the elements are written in blocks by
+    the threads of handy::threadPool().
+
+    If the input is an rvalue owning its elements (its iterators return real references), they are
+    moved instead of copied. A handy::Zip, whose elements are references to other containers, is never
+    moved from.
+*/
+
+#ifndef HANDY_ZIP_ITER_COLUMNS_H
+#define HANDY_ZIP_ITER_COLUMNS_H
+
+#include "ZipIter.h"
+
+
+namespace handy
+{
+
+namespace impl
+{
+
+namespace zip
+{
+
+/// Minimum number of elements written by a single thread
+constexpr std::size_t minColumnBlock = 1 << 12;
+
+
+/** @name
+    @brief Tells if @p T has the @c resize(n), @c reserve(n) and @c push_back(value) member functions
+*/
+//@{
+template <typename T, typename = void>
+struct HasResize : std::false_type {};
+
+template <typename T>
+struct HasResize<T, std::void_t<decltype(std::declval<T&>().resize(std::size_t()))>> : std::true_type {};
+
+template <typename T, typename = void>
+struct HasReserve : std::false_type {};
+
+template <typename T>
+struct HasReserve<T, std::void_t<decltype(std::declval<T&>().reserve(std::size_t()))>> : std::true_type {};
+
+template <typename T, typename = void>
+struct HasPushBack : std::false_type {};
+
+template <typename T>
+struct HasPushBack<T, std::void_t<decltype(std::declval<T&>().push_back(*std::begin(std::declval<T&>())))>> : std::true_type {};
+//@}
+
+
+/// If the range @p R is random access
+template <typename R>
+constexpr bool isRandomAccess = std::is_same< typename std::iterator_traits< decltype( begin( std::declval<R&>() ) ) >::iterator_category,
+                                              std::random_access_iterator_tag >::value;
+
+/// If the elements of the range @p R, given as an rvalue or lvalue @p R, can be moved from
+template <typename R>
+constexpr bool movable = !std::is_lvalue_reference< R >::value &&
+                         std::is_lvalue_reference< decltype( *std::begin( std::declval<R&>() ) ) >::value;
+
+
+/// The element @p I of the tuple @p t, moved if @p Move
+template <std::size_t I, bool Move, class Tuple>
+decltype(auto) getElem (Tuple&& t)
+{
+    if constexpr(Move)
+        return std::move( std::get< I >( t ) );
+
+    else
+        return std::get< I >( t );
+}
+
+/// The element of @p t, moved if @p Move
+template <bool Move, typename T>
+decltype(auto) forwardElem (T& t)
+{
+    if constexpr(Move)
+        return std::move( t );
+
+    else
+        return t;
+}
+
+
+/** @brief Prepares @p out to receive @p n more elements, returning the position of the first one
+
+    Containers with @c push_back are appended to: they are resized if @p resize, otherwise reserved.
+    The others are written from their beginning.
+*/
+template <class Out>
+std::size_t prepare (Out& out, std::size_t n, bool resize)
+{
+    if constexpr(HasPushBack< Out >::value)
+    {
+        std::size_t offset = out.size();
+
+        if constexpr(HasResize< Out >::value)
+            if(resize)
+                return out.resize( offset + n ), offset;
+
+        if constexpr(HasReserve< Out >::value)
+            out.reserve( offset + n );
+
+        return offset;
+    }
+
+    else
+        return 0;
+}
+
+
+/// If the elements of @p Out are distinct objects, so they can be written from several threads. Not for proxy references, as the bits of a @c std::vector<bool>
+template <class Out>
+constexpr bool distinctElements = std::is_lvalue_reference< typename std::iterator_traits< decltype( begin( std::declval<Out&>() ) ) >::reference >::value;
+
+/// If @p Out can be written by index after handy::impl::zip::prepare(), in parallel
+template <class Out>
+constexpr bool indexable = isRandomAccess< Out > && distinctElements< Out > && (HasResize< Out >::value || !HasPushBack< Out >::value);
+
+
+/// Iterator writing the elements of @p out: a @c std::back_inserter if it has @c push_back, otherwise its begin
+template <class Out>
+auto outIter (Out& out)
+{
+    if constexpr(HasPushBack< Out >::value)
+        return std::back_inserter( out );
+
+    else
+        return begin( out );
+}
+
+
+/// Number of elements of @p r, if its size is known, or zero
+template <class R>
+std::size_t sizeOf (const R& r)
+{
+    if constexpr(IsSized< const R >::value && !std::is_pointer< R >::value)
+        return std::size( r );
+
+    else
+        return 0;
+}
+
+
+
+template <bool Move, class Range, class... Outs, std::size_t... Is>
+void unzipInto (Range& range, std::index_sequence<Is...>, Outs&... outs)
+{
+    constexpr bool byIndex = isRandomAccess< Range > && And_v< indexable< Outs >... >;
+
+    std::size_t n = sizeOf( range );
+
+    auto offsets = std::make_tuple( prepare( outs, n, byIndex )... );
+
+    if constexpr(byIndex)
+    {
+        auto first = begin( range );
+        auto dsts = std::make_tuple( std::next( begin( outs ), std::get< Is >( offsets ) )... );
+
+        parallel::forBlocks(n, [&](std::size_t b, std::size_t e)
+        {
+            for(std::size_t i = b; i < e; ++i)
+            {
+                auto&& elem = first[i];
+
+                ((std::get< Is >( dsts )[i] = getElem< Is, Move >( elem )), ...);
+            }
+
+        }, minColumnBlock);
+    }
+
+    else
+    {
+        auto dsts = std::make_tuple( outIter( outs )... );
+
+        for(auto&& elem : range)
+            ((*std::get< Is >( dsts )++ = getElem< Is, Move >( elem )), ...);
+    }
+}
+
+
+template <bool... Moves, class Out, class... Columns>
+void zipInto (Out& out, Columns&... columns)
+{
+    using V = std::decay_t< decltype( *begin( out ) ) >;
+
+    constexpr bool byIndex = indexable< Out > && And_v< isRandomAccess< Columns >... >;
+
+    std::size_t n = sizeOf( std::get< 0 >( std::tie( columns... ) ) );
+
+    std::size_t offset = prepare( out, n, byIndex );
+
+    if constexpr(byIndex)
+    {
+        auto dst = std::next( begin( out ), offset );
+        auto srcs = std::make_tuple( begin( columns )... );
+
+        parallel::forBlocks(n, [&](std::size_t b, std::size_t e)
+        {
+            for(std::size_t i = b; i < e; ++i)
+                std::apply([&](auto... its){ dst[i] = V{ forwardElem< Moves >( its[i] )... }; }, srcs);
+
+        }, minColumnBlock);
+    }
+
+    else
+    {
+        auto dst = outIter( out );
+
+        for(auto&& elems : handy::zip( columns... ))
+            unZip(elems, [&](auto&... elem){ *dst++ = V{ forwardElem< Moves >( elem )... }; });
+    }
+}
+
+} // namespace zip
+
+} // namespace impl
+
+
+
+/** @ingroup ZipIterGroup
+    @copydoc Columns.h
+*/
+//@{
+
+/** @brief Writes the element @c I of each tuple of @p range into the output @c I of @p outs
+
+    @param range A range of tuple like elements (@c std::tuple, @c std::pair, or the elements of a handy::Zip)
+    @param outs One container per element of the tuples. Containers with @c push_back are appended to,
+                the others must already have at least the size of @p range
+*/
+template <class Range, class... Outs>
+void unzipInto (Range&& range, Outs&&... outs)
+{
+    impl::zip::unzipInto< impl::zip::movable< Range > >( range, std::index_sequence_for< Outs... >(), outs... );
+}
+
+
+/** @brief Writes into @p out one element for each position of the @p columns, built from their elements
+
+    The elements are constructed as <tt>value_type{ columns[i]... }</tt>, so @p out can hold tuples,
+    pairs or aggregates. The number of elements is the size of the first column. Each column given as
+    an rvalue is moved from.
+
+    @return @p out
+*/
+template <class Out, class Column, class... Columns>
+Out&& zipInto (Out&& out, Column&& column, Columns&&... columns)
+{
+    impl::zip::zipInto< impl::zip::movable< Column >, impl::zip::movable< Columns >... >( out, column, columns... );
+
+    return std::forward<Out>(out);
+}
+
+//@}
+
+} // namespace handy
+
+
+#endif // HANDY_ZIP_ITER_COLUMNS_H
@@ -25,7 +25,9 @@
     and std::end definitions or is a pointer).
    
     These macros simply call handy::impl::zip::begin and handy::impl::zip::end for each argument, delegating 
-    the call to std::begin and std::end, while also supporting pointer types to be called.
+    the call to std::begin and std::end. A pointer has no end by itself, so ZIP_END() does not accept it,
+    and ZIP_ALL() calls handy::zipBegin() and handy::zipEnd(), which end the pointers at the size of the
+    first container.
 */
 //@{
 #define ZIP_BEGIN1(x, ...) ::handy::impl::zip::begin(x)
@@ -52,31 +54,13 @@
 #define ZIP_END(...) APPLY_N(ZIP_END, __VA_ARGS__)
 
 
-#define ZIP_ALL(...) EXPAND(::handy::zipIter(EXPAND(CONCAT(ZIP_BEGIN, NUM_ARGS(__VA_ARGS__)))(__VA_ARGS__)),  \
-                            ::handy::zipIter(EXPAND(CONCAT(ZIP_END,   NUM_ARGS(__VA_ARGS__)))(__VA_ARGS__)))
+#define ZIP_ALL(...) ::handy::zipBegin(__VA_ARGS__), ::handy::zipEnd(__VA_ARGS__)
 
 //@}
 
 
 
 
-namespace std
-{
-    /** This call converts a rvalue std::tuple to a lvalue and calls std::swap.
-        
-        This definition is necessary for some stl functions that use std::swap. 
-        
-        As long as I could see, there is no performance overhead
-    */
-    template <typename... Args>
-    void swap (std::tuple<Args...>&& a, std::tuple<Args...>&& b) noexcept
-    {
-        swap(a, b);
-    }
-}
-
-
-
 namespace handy
 {
 namespace impl
@@ -97,6 +81,7 @@ template <typename T>                struct Iterable<const T*>   { using iterato
 
 
 /// This is the order of the iterator types. The smaller is the more generic.
+constexpr int iterTagOrder ( std::input_iterator_tag )         { return -1; }
 constexpr int iterTagOrder ( std::forward_iterator_tag )       { return 0; }
 constexpr int iterTagOrder ( std::bidirectional_iterator_tag ) { return 1; }
 constexpr int iterTagOrder ( std::random_access_iterator_tag ) { return 2; }
@@ -122,6 +107,86 @@ template <class... Iter> using SelectIterTag_t = typename SelectIterTag< Iter...
 
 
 
+/** @brief Proxy reference returned when dereferencing a handy::ZipIter
+
+    It is a std::tuple of the references returned by each iterator, so std::get, std::tuple_size and the
+    tuple comparisons work as usual. Assigning to it assigns to the referenced elements (moving from
+    them if the right hand side is a tuple of values or of rvalue references), and swapping two of them
+    swaps the referenced elements.
+
+    As in any proxy, assigning from another rvalue Reference copies the elements, so @c std::copy over
+    zipped iterators never moves from the source.
+*/
+template <typename... Refs>
+class Reference : public std::tuple<Refs...>
+{
+public:
+
+    using Base = std::tuple<Refs...>;
+
+    using Base::Base;
+
+
+    Reference (const Reference&) = default;
+
+    Reference (Reference&&) = default;
+
+
+    /** @name
+        @brief Assignment to the referenced elements
+    */
+    //@{
+    Reference& operator = (const Reference& ref)
+    {
+        return assign(ref, std::index_sequence_for<Refs...>());
+    }
+
+    Reference& operator = (Reference&& ref)
+    {
+        return assign(ref, std::index_sequence_for<Refs...>());
+    }
+
+    template <class Tuple, std::enable_if_t< std::tuple_size< std::decay_t< Tuple > >::value == sizeof...(Refs), int > = 0>
+    Reference& operator = (Tuple&& tup)
+    {
+        return assign(std::forward<Tuple>(tup), std::index_sequence_for<Refs...>());
+    }
+    //@}
+
+
+    /// Swaps the referenced elements
+    friend void swap (Reference a, Reference b)
+    {
+        swap(a, b, std::index_sequence_for<Refs...>());
+    }
+
+
+private:
+
+    template <class Tuple, std::size_t... Is>
+    Reference& assign (Tuple&& tup, std::index_sequence<Is...>)
+    {
+        ((std::get<Is>(*this) = std::get<Is>(std::forward<Tuple>(tup))), ...);
+
+        return *this;
+    }
+
+    template <std::size_t... Is>
+    static void swap (Reference& a, Reference& b, std::index_sequence<Is...>)
+    {
+        using std::swap;
+
+        (swap(std::get<Is>(a), std::get<Is>(b)), ...);
+    }
+};
+
+
+/// The type returned by @c iter_move for an iterator whose dereference type is @p Ref
+template <typename Ref>
+using RvalueRef = std::conditional_t< std::is_lvalue_reference< Ref >::value, std::remove_reference_t< Ref >&&, Ref >;
+
+
+
 /// Avoids some boilerplate in the definition of the 'ZipIter' class
 template <typename... Iters>
 using IteratorBase = std::iterator < impl::zip::SelectIterTag_t< typename std::iterator_traits< Iters >::iterator_category... >, 
@@ -160,13 +225,143 @@ decltype(auto) end (T&& t) noexcept
     return std::end(std::forward<T>(t)); /// Simply delegating the call for any other type
 }
 
+/// A pointer has no end by itself. It is given by its length, as in handy::zipEnd()
 template <typename T, std::enable_if_t< std::is_pointer< std::decay_t<T> >::value, int > = 0>
-decltype(auto) end (T t) noexcept
+void end (T t) = delete;
+
+
+/// The end of @p t, or @p t plus @p length if it is a pointer
+template <typename T>
+decltype(auto) end (T&& t, std::size_t length) noexcept
+{
+    if constexpr(std::is_pointer< std::decay_t<T> >::value)
+        return t + length;
+
+    else
+        return handy::impl::zip::end(std::forward<T>(t));
+}
+
+
+
+
+/** @brief Base iterator of @p t for a handy::CountedZipIter
+
+    The pointer to the memory of @p t if it has a @c data() member, so the compiler sees only pointer
+    arithmetic. Otherwise, its begin iterator. Containers whose elements may be strided give their begin,
+    which checks they are contiguous.
+*/
+template <typename T>
+auto base (T&& t)
 {
-    return t + std::size_t(1e13); /// It is simply a unreachable point
+    if constexpr(!std::is_pointer< std::decay_t<T> >::value && HasData< std::remove_reference_t<T> >::value &&
+                 !MaybeStrided< std::remove_reference_t<T> >::value)
+        return t.data();
+
+    else
+        return begin(std::forward<T>(t));
 }
 
 
+/// Tells if the size of @p T is known, through @c std::size
+template <typename T, typename = void>
+struct IsSized : std::false_type {};
+
+template <typename T>
+struct IsSized<T, std::void_t<decltype(std::size(std::declval<T&>()))>> : std::true_type {};
+
+
+/// Tag for the constructor of handy::Zip taking the length of the shortest container
+struct Shortest {};
+
+
+
+/** @brief Random access iterator over the indices <tt>0, 1, 2, ...</tt>, used by handy::enumerate()
+
+    Dereferencing returns the index by value, so there is no memory behind it.
+*/
+class Counter
+{
+public:
+
+    using value_type        = std::size_t;
+    using reference         = std::size_t;
+    using pointer           = void;
+    using difference_type   = std::ptrdiff_t;
+    using iterator_category = std::random_access_iterator_tag;
+
+
+    Counter (std::size_t pos = 0) : pos(pos) {}
+
+
+    std::size_t operator * () const { return pos; }
+
+    std::size_t operator [] (difference_type inc) const { return pos + inc; }
+
+
+    Counter& operator ++ () { ++pos; return *this; }
+
+    Counter& operator -- () { --pos; return *this; }
+
+    Counter operator ++ (int) { return Counter(pos++); }
+
+    Counter operator -- (int) { return Counter(pos--); }
+
+    Counter& operator += (difference_type inc) { pos += inc; return *this; }
+
+    Counter& operator -= (difference_type inc) { pos -= inc; return *this; }
+
+    friend Counter operator + (Counter iter, difference_type inc) { return iter += inc; }
+
+    friend Counter operator + (difference_type inc, Counter iter) { return iter += inc; }
+
+    friend Counter operator - (Counter iter, difference_type inc) { return iter -= inc; }
+
+    friend difference_type operator - (Counter iter1, Counter iter2) { return difference_type(iter1.pos - iter2.pos); }
+
+
+    friend bool operator == (Counter iter1, Counter iter2) { return iter1.pos == iter2.pos; }
+
+    friend bool operator != (Counter iter1, Counter iter2) { return iter1.pos != iter2.pos; }
+
+    friend bool operator <  (Counter iter1, Counter iter2) { return iter1.pos < iter2.pos; }
+
+    friend bool operator >  (Counter iter1, Counter iter2) { return iter1.pos > iter2.pos; }
+
+    friend bool operator <= (Counter iter1, Counter iter2) { return iter1.pos <= iter2.pos; }
+
+    friend bool operator >= (Counter iter1, Counter iter2) { return iter1.pos >= iter2.pos; }
+
+
+private:
+
+    std::size_t pos;    ///< The current index
+};
+
+
+/// The indices <tt>[0, n)</tt>, as a container of handy::impl::zip::Counter
+struct Indices
+{
+    using iterator = Counter;
+    using const_iterator = Counter;
+    using value_type = std::size_t;
+
+    Counter begin () const { return Counter(0); }
+
+    Counter end () const { return Counter(n); }
+
+    std::size_t size () const { return n; }
+
+
+    std::size_t n;      ///< Number of indices
+};
+
+
+/// Tells if all the @p Iters are random access iterators
+template <typename... Iters>
+constexpr bool allRandomAccess = And_v< std::is_same< typename std::iterator_traits< Iters >::iterator_category,
+                                                      std::random_access_iterator_tag >::value... >;
+
+
 
 
 /** This utility takes variadic arguments and packs them in a single tuple.
@@ -179,6 +374,12 @@ decltype(auto) packArgs (std::tuple< ArgsTup... > tup)
     return tup;
 }
 
+template <typename... Refs>
+decltype(auto) packArgs (Reference<Refs...> ref)
+{
+    return std::tuple<Refs...>(std::move(ref));
+}
+
 template <typename T>
 decltype(auto) packArgs (T&& t)
 {
@@ -191,6 +392,12 @@ decltype(auto) packArgs (std::tuple<ArgsTup...> tup, Args&&... args)
     return std::tuple_cat( std::move( tup ), std::move( packArgs(std::forward<Args>(args)...) ) );
 }
 
+template <typename... Refs, typename... Args>
+decltype(auto) packArgs (Reference<Refs...> ref, Args&&... args)
+{
+    return packArgs(std::tuple<Refs...>(std::move(ref)), std::forward<Args>(args)...);
+}
+
 template <typename T, typename... Args>
 decltype(auto) packArgs (T&& t, Args&&... args)
 {
@@ -215,6 +422,9 @@ template <typename... TupArgs, typename... Args>
 struct CountElements<std::tuple<TupArgs...>, Args...> : std::integral_constant<std::size_t, sizeof...(TupArgs) + 
                                                                                CountElements< Args... >::value> {};
 
+template <typename... Refs, typename... Args>
+struct CountElements<Reference<Refs...>, Args...> : CountElements<std::tuple<Refs...>, Args...> {};
+
 
 } // namespace zip
 
@@ -223,4 +433,17 @@ struct CountElements<std::tuple<TupArgs...>, Args...> : std::integral_constant<s
 } // namespace handy
 
 
+
+namespace std
+{
+    /// The handy::impl::zip::Reference proxy behaves as a std::tuple, also in structured bindings
+    template <typename... Refs>
+    struct tuple_size<handy::impl::zip::Reference<Refs...>> : std::tuple_size<std::tuple<Refs...>> {};
+
+    /// @copydoc tuple_size
+    template <std::size_t I, typename... Refs>
+    struct tuple_element<I, handy::impl::zip::Reference<Refs...>> : std::tuple_element<I, std::tuple<Refs...>> {};
+}
+
+
 #endif // HANDY_ZIP_ITER_HELPERS_H
\ No newline at end of file
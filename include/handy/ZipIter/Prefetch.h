@@ -0,0 +1,217 @@
+/** @file
+
+    @brief Software prefetching while iterating over a handy::Zip
+
+    handy::prefetch() wraps a handy::Zip of random access containers, so that reading each element
+    also asks the processor to bring to cache the memory needed @c D elements ahead. This hides the
+    latency of the main memory in loops whose accesses the hardware prefetcher can not predict, as the
+    ones going through an array of indices:
+
+    @code{.cpp}
+    std::vector<std::uint32_t> idx = ...;        // Random positions of 'data'
+    std::vector<float> data = ..., out(idx.size());
+
+    auto target = [&](auto&& elem){ return &data[std::get<0>(elem)]; };
+
+    for(auto&& [i, o] : handy::prefetch<16>(handy::zip(idx, out), target))
+        o = data[i];
+    @endcode
+
+    Two kinds of addresses can be prefetched:
+
+    - The memory of the containers (the columns) given by their indices, @c D elements ahead. Ex:
+      <tt>handy::prefetch<64, 0, 1>(handy::zip(a, b))</tt>. Sequential columns are usually already
+      prefetched by the hardware, so this is rarely useful, but it can be measured.
+    - Indirect targets: functions taking the zipped element @c D positions ahead, and returning the address
+      it will access.
+
+    The distance @c D is a trade off: it must cover the latency of a memory access, but not so much that
+    the prefetched lines are evicted before being used. Measure (see the @c PrefetchBenchmark example).
+
+    Nothing is prefetched past the end of the zip, and with compilers other than GCC and Clang the
+    prefetches are no-ops.
+*/
+
+#ifndef HANDY_ZIP_ITER_PREFETCH_H
+#define HANDY_ZIP_ITER_PREFETCH_H
+
+#include "ZipIter.h"
+
+
+/// Hint to bring the memory at @p addr to the cache, for reading
+#if defined(__GNUC__) || defined(__clang__)
+    #define HANDY_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+    #define HANDY_PREFETCH(addr) ((void)(addr))
+#endif
+
+
+namespace handy
+{
+
+/** @ingroup ZipIterGroup
+    @copydoc Prefetch.h
+*/
+//@{
+
+/** @brief A handy::Zip (or a reference to one) whose iterator prefetches @p D elements ahead
+
+    @tparam D The prefetch distance, in number of elements
+    @tparam Zipped The handy::Zip type. A reference if it was given as an lvalue
+    @tparam Columns A @c std::index_sequence of the columns whose memory is prefetched
+    @tparam Targets Functions returning the addresses accessed by an element
+*/
+template <std::size_t D, class Zipped, class Columns, class... Targets>
+class Prefetch;
+
+template <std::size_t D, class Zipped, std::size_t... Cols, class... Targets>
+class Prefetch<D, Zipped, std::index_sequence<Cols...>, Targets...>
+{
+public:
+
+    /// The iterator of the handy::Zip
+    using base_iterator = decltype( std::declval< std::remove_reference_t< Zipped >& >().begin() );
+
+    static_assert(IsSpecialization< base_iterator, CountedZipIter >::value,
+                  "handy::prefetch needs a handy::Zip of random access containers");
+
+
+    /// Random access iterator delegating to the base one, prefetching at every dereference
+    class iterator
+    {
+    public:
+
+        using value_type        = typename base_iterator::value_type;
+        using reference         = typename base_iterator::reference;
+        using pointer           = void;
+        using difference_type   = std::ptrdiff_t;
+        using iterator_category = std::random_access_iterator_tag;
+
+
+        iterator (const Prefetch& range, base_iterator it) : range(&range), it(it) {}
+
+
+        reference operator * () const
+        {
+            prefetch();
+
+            return *it;
+        }
+
+        reference operator [] (difference_type inc) const { return *(*this + inc); }
+
+
+        iterator& operator ++ () { ++it; return *this; }
+
+        iterator& operator -- () { --it; return *this; }
+
+        iterator operator ++ (int) { iterator temp{*this}; ++it; return temp; }
+
+        iterator operator -- (int) { iterator temp{*this}; --it; return temp; }
+
+        iterator& operator += (difference_type inc) { it += inc; return *this; }
+
+        iterator& operator -= (difference_type inc) { it -= inc; return *this; }
+
+        friend iterator operator + (iterator iter, difference_type inc) { return iter += inc; }
+
+        friend iterator operator + (difference_type inc, iterator iter) { return iter += inc; }
+
+        friend iterator operator - (iterator iter, difference_type inc) { return iter -= inc; }
+
+        friend difference_type operator - (const iterator& iter1, const iterator& iter2) { return iter1.it - iter2.it; }
+
+
+        friend bool operator == (const iterator& iter1, const iterator& iter2) { return iter1.it == iter2.it; }
+
+        friend bool operator != (const iterator& iter1, const iterator& iter2) { return iter1.it != iter2.it; }
+
+        friend bool operator <  (const iterator& iter1, const iterator& iter2) { return iter1.it < iter2.it; }
+
+        friend bool operator >  (const iterator& iter1, const iterator& iter2) { return iter1.it > iter2.it; }
+
+        friend bool operator <= (const iterator& iter1, const iterator& iter2) { return iter1.it <= iter2.it; }
+
+        friend bool operator >= (const iterator& iter1, const iterator& iter2) { return iter1.it >= iter2.it; }
+
+
+        friend auto iter_move (const iterator& iter) { return iter_move(iter.it); }
+
+        friend void iter_swap (const iterator& iter1, const iterator& iter2) { iter_swap(iter1.it, iter2.it); }
+
+
+    private:
+
+        /// Prefetches the columns and the targets of the element @p D positions ahead, if there is one
+        void prefetch () const
+        {
+            if(it.index() + difference_type(D) >= range->length)
+                return;
+
+            (HANDY_PREFETCH( &*( std::get< Cols >( it.bases() ) + ( it.index() + difference_type(D) ) ) ), ...);
+
+            if constexpr(sizeof...(Targets) > 0)
+            {
+                auto&& ahead = it[D];
+
+                std::apply([&](const auto&... targets){ (HANDY_PREFETCH( targets( ahead ) ), ...); }, range->targets);
+            }
+        }
+
+
+        const Prefetch* range;  ///< The range, for the length and the targets
+        base_iterator it;       ///< The base iterator
+    };
+
+    using const_iterator = iterator;
+
+    using value_type = typename iterator::value_type;
+
+    using iterator_category = std::random_access_iterator_tag;
+
+
+
+    /// Takes the handy::Zip and the functions returning the addresses accessed by an element
+    Prefetch (Zipped zipped, Targets... targets) : zipped( std::forward<Zipped>( zipped ) ), targets( targets... ),
+                                                   length( this->zipped.size() ) {}
+
+
+    iterator begin () const { return iterator( *this, zipped.begin() ); }
+
+    iterator end () const { return iterator( *this, zipped.end() ); }
+
+    std::size_t size () const { return std::size_t( length ); }
+
+    /// The element at position @p pos, without prefetching
+    auto operator [] (std::size_t pos) const { return zipped[pos]; }
+
+
+private:
+
+    Zipped zipped;                          ///< The handy::Zip
+    std::tuple< Targets... > targets;       ///< Functions returning the addresses accessed by an element
+    std::ptrdiff_t length;                  ///< Number of elements
+};
+
+
+
+/** @brief Iterates over @p zipped prefetching the @p Cols columns and the @p targets @p D elements ahead
+
+    @tparam D The prefetch distance, in number of elements
+    @tparam Cols The indices of the containers whose memory is prefetched
+
+    @param zipped A handy::Zip of random access containers. It is held by reference if it is an lvalue
+    @param targets Functions taking a zipped element and returning an address that it will access
+*/
+template <std::size_t D, std::size_t... Cols, class Zipped, class... Targets>
+auto prefetch (Zipped&& zipped, Targets... targets)
+{
+    return Prefetch< D, Zipped, std::index_sequence< Cols... >, Targets... >( std::forward<Zipped>( zipped ), targets... );
+}
+
+//@}
+
+} // namespace handy
+
+
+#endif // HANDY_ZIP_ITER_PREFETCH_H
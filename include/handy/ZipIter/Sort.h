@@ -0,0 +1,273 @@
+/** @file
+
+    @brief Parallel sort of zipped random access containers, keyed on one of them
+
+    handy::sortBy() sorts all the containers of a handy::Zip together, ordering them by the column @c K:
+
+    @code{.cpp}
+    std::vector<int> ids = ...;
+    std::vector<double> prices = ...;
+    std::vector<std::string> names = ...;
+
+    handy::sortBy<1>(handy::zip(ids, prices, names));                    // By price
+    handy::sortBy<2>(handy::zip(ids, prices, names), std::greater<>());  // By name, descending
+    @endcode
+
+    Instead of swapping whole tuples, the permutation that sorts the keys is computed first, and then
+    applied to each column, one at a time, by a sequential write of a gathered copy. Keys that are small
+    and trivially copyable are sorted along with their positions in a contiguous buffer, the others
+    through their positions only.
+
+    The permutation is computed in parallel, by the threads of handy::threadPool(). Integral keys in
+    ascending order go through a radix sort, and any other keys through a merge sort, whose blocks are
+    sorted independently and then merged pairwise. Both are stable.
+*/
+
+#ifndef HANDY_ZIP_ITER_SORT_H
+#define HANDY_ZIP_ITER_SORT_H
+
+#include "ZipIter.h"
+
+#include <vector>
+#include <numeric>
+#include <functional>
+#include <array>
+
+
+namespace handy
+{
+
+namespace impl
+{
+
+namespace zip
+{
+
+/// Minimum number of elements sorted or gathered by a single thread
+constexpr std::size_t minSortBlock = 1 << 14;
+
+
+/** @brief Stable sort of @p v with @p comp, in parallel
+
+    The vector is split into a power of two blocks, at most one per thread, which are sorted
+    independently and then merged pairwise into a buffer, halving the number of blocks each round.
+*/
+template <typename T, class Compare>
+void parallelStableSort (std::vector<T>& v, Compare comp)
+{
+    std::size_t n = v.size(), blocks = 1;
+
+    while(2 * blocks <= threadPool().size() && n / (2 * blocks) >= minSortBlock)
+        blocks *= 2;
+
+    auto bound = [n](std::size_t b, std::size_t numBlocks){ return n * b / numBlocks; };
+
+    threadPool().run(blocks, [&](std::size_t b)
+    {
+        std::stable_sort(v.begin() + bound(b, blocks), v.begin() + bound(b + 1, blocks), comp);
+    });
+
+    if(blocks == 1)
+        return;
+
+    std::vector<T> buffer(n);
+
+    for(; blocks > 1; blocks /= 2)
+    {
+        threadPool().run(blocks / 2, [&](std::size_t b)
+        {
+            auto first = v.begin() + bound(2 * b, blocks);
+            auto middle = v.begin() + bound(2 * b + 1, blocks);
+            auto last = v.begin() + bound(2 * b + 2, blocks);
+
+            std::merge(first, middle, middle, last, buffer.begin() + (first - v.begin()), comp);
+        });
+
+        v.swap(buffer);
+    }
+}
+
+
+/** @brief Stable LSD radix sort of integral keys paired with their positions, in parallel
+
+    Each pass sorts by one byte: every thread counts the bytes of its block, and then scatters its
+    block into the positions given by the counts of all the blocks before it. Passes where all the
+    keys have the same byte are skipped.
+*/
+template <typename Key>
+void radixSort (std::vector<std::pair<Key, std::size_t>>& items)
+{
+    using U = std::make_unsigned_t<Key>;
+
+    constexpr U flip = std::is_signed<Key>::value ? U(U(1) << (8 * sizeof(Key) - 1)) : U(0);
+
+    std::size_t n = items.size();
+
+    if(n == 0)
+        return;
+
+    std::size_t blocks = std::max<std::size_t>(1, std::min(threadPool().size(), n / minSortBlock));
+
+    auto bound = [n, blocks](std::size_t b){ return n * b / blocks; };
+
+    std::vector<std::pair<Key, std::size_t>> buffer(n);
+    std::vector<std::array<std::size_t, 256>> counts(blocks);
+
+    for(std::size_t shift = 0; shift < 8 * sizeof(Key); shift += 8)
+    {
+        auto digit = [shift](Key k){ return std::size_t((U(k) ^ flip) >> shift) & 0xFF; };
+
+        threadPool().run(blocks, [&](std::size_t b)
+        {
+            counts[b].fill(0);
+
+            for(std::size_t i = bound(b); i < bound(b + 1); ++i)
+                ++counts[b][digit(items[i].first)];
+        });
+
+        std::size_t same = 0;
+
+        for(const auto& c : counts)
+            same += c[digit(items[0].first)];
+
+        if(same == n)
+            continue;
+
+        for(std::size_t d = 0, total = 0; d < 256; ++d)
+            for(auto& c : counts)
+            {
+                std::size_t count = c[d];
+
+                c[d] = total;
+                total += count;
+            }
+
+        threadPool().run(blocks, [&](std::size_t b)
+        {
+            for(std::size_t i = bound(b); i < bound(b + 1); ++i)
+                buffer[counts[b][digit(items[i].first)]++] = items[i];
+        });
+
+        items.swap(buffer);
+    }
+}
+
+
+/// If @p Compare is the plain ascending order of @p Key
+template <class Compare, typename Key>
+constexpr bool isLess = std::is_same<Compare, std::less<>>::value || std::is_same<Compare, std::less<Key>>::value;
+
+
+/// The positions <tt>[0, n)</tt> in the order that sorts @p keys with @p comp
+template <class Iter, class Compare>
+std::vector<std::size_t> sortingPermutation (Iter keys, std::size_t n, Compare comp)
+{
+    using Key = typename std::iterator_traits<Iter>::value_type;
+
+    std::vector<std::size_t> perm(n);
+
+    if constexpr(std::is_trivially_copyable<Key>::value && sizeof(Key) <= 2 * sizeof(std::size_t))
+    {
+        std::vector<std::pair<Key, std::size_t>> items(n);
+
+        parallel::forBlocks(n, [&](std::size_t b, std::size_t e)
+        {
+            for(std::size_t i = b; i < e; ++i)
+                items[i] = { keys[i], i };
+
+        }, minSortBlock);
+
+        if constexpr(std::is_integral<Key>::value && !std::is_same<Key, bool>::value && isLess<Compare, Key>)
+            radixSort(items);
+
+        else
+            parallelStableSort(items, [&](const auto& a, const auto& b){ return comp(a.first, b.first); });
+
+        parallel::forBlocks(n, [&](std::size_t b, std::size_t e)
+        {
+            for(std::size_t i = b; i < e; ++i)
+                perm[i] = items[i].second;
+
+        }, minSortBlock);
+    }
+
+    else
+    {
+        std::iota(perm.begin(), perm.end(), std::size_t(0));
+
+        parallelStableSort(perm, [&](std::size_t a, std::size_t b){ return comp(keys[a], keys[b]); });
+    }
+
+    return perm;
+}
+
+
+/** @brief Reorders the elements of @p column so the element at <tt>perm[i]</tt> becomes the element @c i
+
+    Columns that can not be assigned (as the indices of handy::enumerate()) are left untouched.
+*/
+template <class Iter>
+void gather (Iter column, const std::vector<std::size_t>& perm)
+{
+    if constexpr(std::is_lvalue_reference<typename std::iterator_traits<Iter>::reference>::value)
+    {
+        using T = typename std::iterator_traits<Iter>::value_type;
+
+        std::size_t n = perm.size();
+
+        std::vector<T> sorted(n);
+
+        parallel::forBlocks(n, [&](std::size_t b, std::size_t e)
+        {
+            for(std::size_t i = b; i < e; ++i)
+                sorted[i] = std::move(column[perm[i]]);
+
+        }, minSortBlock);
+
+        parallel::forBlocks(n, [&](std::size_t b, std::size_t e)
+        {
+            std::move(sorted.begin() + b, sorted.begin() + e, column + b);
+
+        }, minSortBlock);
+    }
+}
+
+} // namespace zip
+
+} // namespace impl
+
+
+
+/** @ingroup ZipIterGroup
+    @copydoc Sort.h
+*/
+//@{
+
+/** @brief Stable sort of all the containers of @p zipped by the container @p K, in parallel
+
+    @tparam K Index of the key container
+
+    @param zipped A handy::Zip of random access containers, whose elements are default constructible
+    @param comp The comparison of the keys
+*/
+template <std::size_t K, class Zipped, class Compare = std::less<>>
+void sortBy (Zipped&& zipped, Compare comp = Compare())
+{
+    auto first = zipped.begin();
+
+    static_assert(IsSpecialization<decltype(first), CountedZipIter>::value,
+                  "handy::sortBy needs a handy::Zip of random access containers");
+
+    const auto& bases = first.bases();
+
+    auto perm = impl::zip::sortingPermutation(std::get<K>(bases) + first.index(), zipped.size(), comp);
+
+    std::apply([&](const auto&... columns){ (impl::zip::gather(columns + first.index(), perm), ...); }, bases);
+}
+
+//@}
+
+} // namespace handy
+
+
+#endif // HANDY_ZIP_ITER_SORT_H
@@ -15,6 +15,11 @@
 #define HANDY_ZIP_ITER_H
 
 #include "Helpers.h"
+#include "../Helpers/Parallel.h"
+
+#include <limits>
+#include <algorithm>
+#include <istream>
 
 
 
@@ -39,7 +44,10 @@ namespace handy
     
     Inherits from std::iterator, being of the most generic std::iterator_category from all of its arguments.
     
-    The value type is a std::tuple of the @c value_type's of all the arguments.
+    The value type is a std::tuple of the @c value_type's of all the arguments. The reference type is
+    a impl::zip::Reference, a proxy tuple of the references to the elements, with proper assignment and
+    @c swap, so algorithms as @c std::sort, @c std::stable_sort and @c std::nth_element permute the
+    elements of all the iterators together. @c iter_swap and @c iter_move are also defined.
     
     The basic iterator interface is implemented, while some functions are only alowed if all the iterator 
     parameters meet some requirements.
@@ -62,7 +70,8 @@ public:
         using iters_type = std::tuple<T, std::remove_reference_t< Iters >...>;
 
         using value_type      = typename Base::value_type;
-        using reference       = typename Base::reference;
+        using reference       = impl::zip::Reference< decltype( *std::declval< T& >() ),
+                                                      decltype( *std::declval< std::remove_reference_t< Iters >& >() )... >;
         using difference_type = typename Base::difference_type;
 
         using iterator_category = typename Base::iterator_category;
@@ -117,17 +126,17 @@ public:
 
 
         template <class Tag = iterator_category, impl::zip::EnableIfMinimumTag< Tag, std::random_access_iterator_tag > = 0 >
-        ZipIter& operator += (int inc)
+        ZipIter& operator += (difference_type inc)
         {
-          applyTuple([](auto&& x, int inc) { return x += inc; }, iters, inc);
+          applyTuple([](auto&& x, difference_type inc) { return x += inc; }, iters, inc);
 
           return *this;
         }
 
         template <class Tag = iterator_category, impl::zip::EnableIfMinimumTag< Tag, std::random_access_iterator_tag > = 0 >
-        ZipIter& operator -= (int inc)
+        ZipIter& operator -= (difference_type inc)
         {
-            applyTuple([](auto&& x, int inc) { return x += inc; }, iters, -inc);
+            applyTuple([](auto&& x, difference_type inc) { return x += inc; }, iters, -inc);
 
             return *this;
         }
@@ -141,14 +150,21 @@ public:
         //@{
 
 
-        friend auto operator+ (ZipIter<T, Iters...> iter, int inc)
+        friend auto operator+ (ZipIter<T, Iters...> iter, difference_type inc)
+        {
+            iter += inc;
+
+            return iter;
+        }
+
+        friend auto operator+ (difference_type inc, ZipIter<T, Iters...> iter)
         {
             iter += inc;
 
             return iter;
         }
 
-        friend auto operator- (ZipIter<T, Iters...> iter, int inc)
+        friend auto operator- (ZipIter<T, Iters...> iter, difference_type inc)
         {
             iter -= inc;
 
@@ -167,9 +183,14 @@ public:
         }
 
 
+        /// For single pass iterators, two iterators are equal if any of their components is, so the end is reached with the shortest input
         friend bool operator== (const ZipIter<T, Iters...>& iter1, const ZipIter<T, Iters...>& iter2)
         {
-            return std::get<0>(iter1.iters) == std::get<0>(iter2.iters);
+            if constexpr(std::is_same< iterator_category, std::input_iterator_tag >::value)
+                return anyEqual( iter1.iters, iter2.iters, std::make_index_sequence< sizeof... (Iters) + 1 >() );
+
+            else
+                return std::get<0>(iter1.iters) == std::get<0>(iter2.iters);
         }
 
         friend bool operator!= (const ZipIter<T, Iters...>& iter1, const ZipIter<T, Iters...>& iter2)
@@ -190,12 +211,12 @@ public:
 
         friend bool operator<= (const ZipIter<T, Iters...>& iter1, const ZipIter<T, Iters...>& iter2)
         {
-            return !operator>(iter2, iter1);
+            return !operator>(iter1, iter2);
         }
 
         friend bool operator>= (const ZipIter<T, Iters...>& iter1, const ZipIter<T, Iters...>& iter2)
         {
-            return !operator<(iter2, iter1);
+            return !operator<(iter1, iter2);
         }
         //@}
 
@@ -209,14 +230,31 @@ public:
             and because it is almost not used (not by any stl function I now).
         */
         //@{
-        decltype(auto) operator * ()
+        reference operator * () const
         {
         	return dereference( std::make_index_sequence< sizeof... (Iters) + 1 >() );
         }
 
-        decltype(auto) operator * () const
+        template <class Tag = iterator_category, impl::zip::EnableIfMinimumTag< Tag, std::random_access_iterator_tag > = 0 >
+        reference operator [] (difference_type pos) const
         {
-        	return dereference( std::make_index_sequence< sizeof... (Iters) + 1 >() );
+            return *(*this + pos);
+        }
+        //@}
+
+
+        /** @name
+            @brief Customization points for algorithms that move or swap through the iterators
+        */
+        //@{
+        friend auto iter_move (const ZipIter& iter)
+        {
+            return iter.move( std::make_index_sequence< sizeof... (Iters) + 1 >() );
+        }
+
+        friend void iter_swap (const ZipIter& iter1, const ZipIter& iter2)
+        {
+            swap(*iter1, *iter2);
         }
         //@}
 
@@ -226,22 +264,27 @@ private:
 
 
 
-    /** @name
-        @brief Here the tuple of value is returned as a temporary to avoid any extra extorage or access
-    */
-    //@{
+    /// Here the tuple of references is returned as a temporary to avoid any extra extorage or access
     template <std::size_t... Is>
-    auto dereference (std::index_sequence<Is...>)
+    reference dereference (std::index_sequence<Is...>) const
     {
-        return std::forward_as_tuple( *std::get< Is >( iters )... );
+        return reference( *std::get< Is >( iters )... );
     }
 
+    /// If any pair of iterators of @p iters1 and @p iters2 are equal
     template <std::size_t... Is>
-    auto dereference (std::index_sequence<Is...>) const
+    static bool anyEqual (const iters_type& iters1, const iters_type& iters2, std::index_sequence<Is...>)
     {
-        return std::forward_as_tuple( *std::get< Is >( iters )... );
+        return ((std::get< Is >( iters1 ) == std::get< Is >( iters2 )) || ...);
+    }
+
+    /// A tuple of rvalue references to the elements
+    template <std::size_t... Is>
+    auto move (std::index_sequence<Is...>) const
+    {
+        return std::tuple< impl::zip::RvalueRef< std::tuple_element_t< Is, reference > >... >(
+                           std::move( *std::get< Is >( iters ) )... );
     }
-    //@}
 
 
 
@@ -256,6 +299,172 @@ private:
 
 
 
+/** @brief Random access zip iterator, holding the base iterator of each container and a single index
+
+    @tparam Iters The base iterators (pointers, for containers exposing @c data())
+
+    This is the iterator of a handy::Zip whose containers are all random access. Incrementing, comparing
+    and taking the distance touch only the index, and dereferencing reads every base at the index. So
+    a loop over such a handy::Zip is a plain counted loop, which the compiler is able to vectorize.
+
+    The reference and value types are the same as the ones of handy::ZipIter.
+*/
+template <typename... Iters>
+class CountedZipIter
+{
+public:
+
+        /** @name
+            @brief Some type definitions
+        */
+        //@{
+        using iters_type = std::tuple< Iters... >;
+
+        using value_type      = std::tuple< typename std::iterator_traits< Iters >::value_type... >;
+        using reference       = impl::zip::Reference< decltype( *std::declval< Iters& >() )... >;
+        using pointer         = void;
+        using difference_type = std::ptrdiff_t;
+
+        using iterator_category = std::random_access_iterator_tag;
+        //@}
+
+
+        /// Takes the index and the base iterators
+        CountedZipIter (difference_type pos, Iters... iterators) : iters( iterators... ), pos( pos ) {}
+
+
+
+        /** @name
+            @brief Moving operators, changing only the index
+        */
+        //@{
+        CountedZipIter& operator ++ () { ++pos; return *this; }
+
+        CountedZipIter& operator -- () { --pos; return *this; }
+
+        CountedZipIter operator ++ (int) { return CountedZipIter(*this, pos++); }
+
+        CountedZipIter operator -- (int) { return CountedZipIter(*this, pos--); }
+
+        CountedZipIter& operator += (difference_type inc) { pos += inc; return *this; }
+
+        CountedZipIter& operator -= (difference_type inc) { pos -= inc; return *this; }
+
+
+        friend CountedZipIter operator + (CountedZipIter iter, difference_type inc) { return iter += inc; }
+
+        friend CountedZipIter operator + (difference_type inc, CountedZipIter iter) { return iter += inc; }
+
+        friend CountedZipIter operator - (CountedZipIter iter, difference_type inc) { return iter -= inc; }
+
+        friend difference_type operator - (const CountedZipIter& iter1, const CountedZipIter& iter2)
+        {
+            return iter1.pos - iter2.pos;
+        }
+        //@}
+
+
+        /** @name
+            @brief Comparisons, based on the index only
+        */
+        //@{
+        friend bool operator == (const CountedZipIter& iter1, const CountedZipIter& iter2) { return iter1.pos == iter2.pos; }
+
+        friend bool operator != (const CountedZipIter& iter1, const CountedZipIter& iter2) { return iter1.pos != iter2.pos; }
+
+        friend bool operator <  (const CountedZipIter& iter1, const CountedZipIter& iter2) { return iter1.pos < iter2.pos; }
+
+        friend bool operator >  (const CountedZipIter& iter1, const CountedZipIter& iter2) { return iter1.pos > iter2.pos; }
+
+        friend bool operator <= (const CountedZipIter& iter1, const CountedZipIter& iter2) { return iter1.pos <= iter2.pos; }
+
+        friend bool operator >= (const CountedZipIter& iter1, const CountedZipIter& iter2) { return iter1.pos >= iter2.pos; }
+        //@}
+
+
+        /** @name
+            @brief Dereferencing operators
+        */
+        //@{
+        reference operator * () const
+        {
+            return dereference( pos, std::index_sequence_for< Iters... >() );
+        }
+
+        reference operator [] (difference_type inc) const
+        {
+            return dereference( pos + inc, std::index_sequence_for< Iters... >() );
+        }
+        //@}
+
+
+        /** @name
+            @brief Customization points for algorithms that move or swap through the iterators
+        */
+        //@{
+        friend auto iter_move (const CountedZipIter& iter)
+        {
+            return iter.move( std::index_sequence_for< Iters... >() );
+        }
+
+        friend void iter_swap (const CountedZipIter& iter1, const CountedZipIter& iter2)
+        {
+            swap(*iter1, *iter2);
+        }
+        //@}
+
+
+        /// The index of the iterator
+        difference_type index () const { return pos; }
+
+        /// The base iterators, at index 0
+        const iters_type& bases () const { return iters; }
+
+
+
+private:
+
+    /// Copy with another index
+    CountedZipIter (const CountedZipIter& iter, difference_type pos) : iters( iter.iters ), pos( pos ) {}
+
+
+    template <std::size_t... Is>
+    reference dereference (difference_type p, std::index_sequence<Is...>) const
+    {
+        return reference( *( std::get< Is >( iters ) + p )... );
+    }
+
+    template <std::size_t... Is>
+    auto move (std::index_sequence<Is...>) const
+    {
+        return std::tuple< impl::zip::RvalueRef< std::tuple_element_t< Is, reference > >... >(
+                           std::move( *( std::get< Is >( iters ) + pos ) )... );
+    }
+
+
+    iters_type iters;       ///< The tuple of base iterators
+
+    difference_type pos;    ///< The index
+};
+
+
+
+
+
+
+
+
+namespace impl
+{
+namespace zip
+{
+template <std::size_t W, typename... Ptrs>
+class Batched;
+} // namespace zip
+} // namespace impl
+
+
+
 /** @brief Zip class
     
     @tparam Containers The variadic container types
@@ -264,6 +473,17 @@ private:
     
     It is composed of a tuple of references to containers that are iterable, and exposes a #begin and #end# 
     methods, returning a ZipIter with the iterators of each container passed as argument.
+
+    If all the containers are random access, the iterator is instead a handy::CountedZipIter, going from
+    @c 0 to #size(), and holding a pointer to the memory of each container exposing @c data().
+
+    By default the length is the size of the first container whose size is known, taken each time the
+    iteration starts, so the Zip follows the changes of its containers. The others must be at least as
+    long. A Zip created by handy::zipShortest() takes instead the length of the shortest container, once,
+    at construction, so no container is ever read out of its bounds.
+    Pointers have no size, so they never define the length. If no container has a known size (single
+    pass streams zipped with pointers), the pointers are never at their end, and the iteration stops
+    with the other containers.
 */
 template <typename... Containers>
 class Zip
@@ -277,7 +497,11 @@ public:
     //@{
     using value_type = std::tuple < Containers... >;
 
-    using iterator = ZipIter < typename impl::zip::Iterable<std::remove_reference_t<Containers>>::iterator... >;
+    static constexpr bool counted = impl::zip::allRandomAccess< typename impl::zip::Iterable<std::remove_reference_t<Containers>>::iterator... >;
+
+    using iterator = std::conditional_t< counted,
+                                         CountedZipIter < decltype( impl::zip::base( std::declval<Containers&>() ) )... >,
+                                         ZipIter < typename impl::zip::Iterable<std::remove_reference_t<Containers>>::iterator... > >;
 
     using iterator_category = typename iterator::iterator_category;
     //@}
@@ -299,6 +523,11 @@ public:
     */
     Zip (Containers... containers) : containers( containers... ) {}
 
+    /// The length is the size of the shortest container with a known size
+    Zip (impl::zip::Shortest, Containers... containers) : containers( containers... ),
+                                                          length( shortestSize( std::make_index_sequence<containersSize>() ) ),
+                                                          shortest( true ) {}
+
 
 
     /** @name
@@ -316,23 +545,27 @@ public:
     //@}
 
 
-    /// This is simply a facility for acessing random access containers, returning a tuple of values
-    template <class Tag = iterator_category, impl::zip::EnableIfMinimumTag< Tag, std::random_access_iterator_tag > = 0 >
-    auto operator [] (std::size_t pos)
-    {
-        return at( pos, std::make_index_sequence<containersSize>() );
-    }
-
-    /// @copydoc #operator[]()
+    /// This is simply a facility for acessing random access containers, returning a tuple of references
     template <class Tag = iterator_category, impl::zip::EnableIfMinimumTag< Tag, std::random_access_iterator_tag > = 0 >
     auto operator [] (std::size_t pos) const
     {
-        return at( pos, std::make_index_sequence<containersSize>() );
+        return begin()[ pos ];
     }
 
 
-    /// The size of the first element defines the range
-    std::size_t size () const { return std::get<0>( containers ).size(); }  
+    /// The number of elements iterated: the size of the first sized container, or the #length in the shortest mode
+    std::size_t size () const { return shortest ? length : firstSize(); }
+
+
+    /** @brief Iterates over batches of @p W consecutive elements of each container, plus a tail
+
+        All the containers must expose their contiguous memory through @c data(). See impl::zip::Batched
+    */
+    template <std::size_t W>
+    auto batched ()
+    {
+        return batched<W>( std::make_index_sequence<containersSize>() );
+    }
 
 
 
@@ -346,47 +579,141 @@ private:
     template <std::size_t... Is>
     iterator begin (std::index_sequence<Is...>)
     {
-        return iterator( impl::zip::begin( std::get<Is>( containers ) )... );
+        return makeBegin( std::get<Is>( containers )... );
     }
 
     template <std::size_t... Is>
     const_iterator begin (std::index_sequence<Is...>) const
     {
-        return const_iterator( impl::zip::begin( std::get<Is>( containers ) )... );
+        return makeBegin( std::get<Is>( containers )... );
     }
 
     template <std::size_t... Is>
     iterator end (std::index_sequence<Is...>)
     {
-        return iterator( impl::zip::end( std::get<Is>( containers ) )... );
+        return makeEnd( std::get<Is>( containers )... );
     }
 
     template <std::size_t... Is>
     const_iterator end (std::index_sequence<Is...>) const
     {
-        return const_iterator( impl::zip::end( std::get<Is>( containers ) )... );
+        return makeEnd( std::get<Is>( containers )... );
     }
 
-    template <std::size_t... Is,
-              class Tag = iterator_category,impl::zip::EnableIfMinimumTag< Tag, std::random_access_iterator_tag > = 0 >
-    auto at (std::size_t pos, std::index_sequence<Is...>)
+
+    template <std::size_t W, std::size_t... Is>
+    auto batched (std::index_sequence<Is...>)
+    {
+        static_assert(And_v< std::is_pointer< decltype( impl::zip::base( std::get<Is>( containers ) ) ) >::value... >,
+                      "Batched iteration needs containers with contiguous memory");
+
+        return impl::zip::Batched< W, decltype( impl::zip::base( std::get<Is>( containers ) ) )... >(
+                                   size(), impl::zip::base( std::get<Is>( containers ) )... );
+    }
+
+
+    template <typename... Cs>
+    static iterator makeBegin (Cs&... cs)
     {
-        return std::forward_as_tuple( containers[ Is ]... );
+        if constexpr(counted)
+            return iterator( 0, impl::zip::base( cs )... );
+
+        else
+            return iterator( impl::zip::begin( cs )... );
+    }
+
+    template <typename... Cs>
+    iterator makeEnd (Cs&... cs) const
+    {
+        if constexpr(counted)
+            return iterator( size(), impl::zip::base( cs )... );
+
+        else
+            return iterator( endOf( cs )... );
     }
 
-    template <std::size_t... Is,
-              class Tag = iterator_category, impl::zip::EnableIfMinimumTag< Tag, std::random_access_iterator_tag > = 0 >
-    auto at (std::size_t pos, std::index_sequence<Is...>) const
+    /** The end of a pointer is its begin plus the #size(), or a null pointer, never reached, if the
+        #size() is not known. In the shortest mode, the same goes for any container, except single pass
+        ones, which can not be traversed twice
+    */
+    template <typename C>
+    auto endOf (C& c) const
     {
-        return std::forward_as_tuple( containers[ Is ]... );
+        using Tag = typename std::iterator_traits< decltype( impl::zip::begin( c ) ) >::iterator_category;
+
+        if constexpr(std::is_same< Tag, std::input_iterator_tag >::value)
+            return impl::zip::end( c );
+
+        else if constexpr(std::is_pointer< std::decay_t<C> >::value && firstSized() == containersSize)
+            return decltype( impl::zip::begin( c ) ){};
+
+        else if constexpr(std::is_pointer< std::decay_t<C> >::value)
+            return impl::zip::end( c, size() );
+
+        else
+            return shortest ? std::next( impl::zip::begin( c ), size() ) : impl::zip::end( c );
     }
     //@}
 
 
+    /// Index of the first container whose size is known (pointers are not), or #containersSize if there is none
+    static constexpr std::size_t firstSized ()
+    {
+        constexpr bool known[] = { ( impl::zip::IsSized< std::remove_reference_t< Containers > >::value &&
+                                     !std::is_pointer< std::decay_t< Containers > >::value )... };
+
+        std::size_t pos = 0;
+
+        while(pos < containersSize && !known[pos])
+            ++pos;
+
+        return pos;
+    }
+
+    /// Size of the first container whose size is known, or zero if there is none
+    std::size_t firstSize () const
+    {
+        if constexpr(firstSized() < containersSize)
+            return std::size( std::get< firstSized() >( containers ) );
+
+        else
+            return 0;
+    }
+
+    /// Size of the shortest container whose size is known
+    template <std::size_t... Is>
+    std::size_t shortestSize (std::index_sequence<Is...>) const
+    {
+        static_assert(!And_v< !impl::zip::IsSized< std::remove_reference_t< Containers > >::value... >,
+                      "At least one container must have a known size");
+
+        std::size_t res = std::numeric_limits<std::size_t>::max();
+
+        ((res = std::min(res, sizeOr( std::get<Is>( containers ), res ))), ...);
+
+        return res;
+    }
+
+    /// Size of @p c, or @p other if it is not known
+    template <typename C>
+    static std::size_t sizeOr (const C& c, std::size_t other)
+    {
+        if constexpr(impl::zip::IsSized< const C >::value && !std::is_pointer< C >::value)
+            return std::size( c );
+
+        else
+            return other;
+    }
+
+
 
 
     value_type containers; ///< std::tuple of references to containers
 
+    std::size_t length = 0; ///< Number of elements iterated in the shortest mode
+
+    bool shortest = false;  ///< If the ends are taken from the #length for every container
+
 };
 
 
@@ -419,6 +746,113 @@ auto zip (T&& t, Containers&&... containers)
 
 
 
+/** @brief Zips the containers, iterating up to the length of the shortest one
+    
+    The minimum length is computed once, over the containers whose size is known (pointers are not), and
+    the iteration goes by count up to it. So the longer containers are never read out of bounds.
+
+    @code{.cpp}
+    std::vector<int> a(10), b(7);
+
+    for(auto&& [x, y] : handy::zipShortest(a, b))   // 7 iterations
+        x = y;
+    @endcode
+*/
+template <typename T, typename... Containers, std::enable_if_t< !std::is_pointer< T >::value, int > = 0>
+auto zipShortest (T&& t, Containers&&... containers)
+{
+    return Zip<T, Containers...>(impl::zip::Shortest{}, std::forward<T>(t), std::forward<Containers>(containers)...);
+}
+
+
+
+
+/** @brief Zips the index of each element with the @p containers
+
+    Each element is <tt>(index, refs...)</tt>, where the index is a @c std::size_t value counting from
+    zero. It is the same as zipping a handy::range(), but the index is the counter of the iteration
+    itself, so for random access containers the loop is a single index over the memory of each one.
+
+    @code{.cpp}
+    std::vector<double> x(100), y(100);
+
+    for(auto&& [i, a, b] : handy::enumerate(x, y))
+        a = b * i;
+
+    handy::forEach(handy::par, handy::enumerate(x), [](std::size_t i, double& a){ a = i; });
+    @endcode
+
+    The number of elements is the size of the first container. If it has no @c size(), it is
+    counted once, with @c std::distance.
+*/
+template <typename T, typename... Containers, std::enable_if_t< !std::is_pointer< std::decay_t< T > >::value, int > = 0>
+auto enumerate (T&& t, Containers&&... containers)
+{
+    std::size_t n;
+
+    if constexpr(impl::zip::IsSized< std::remove_reference_t< T > >::value)
+        n = std::size(t);
+
+    else
+        n = std::distance(std::begin(t), std::end(t));
+
+    return Zip<impl::zip::Indices, T, Containers...>(impl::zip::Indices{ n }, std::forward<T>(t),
+                                                     std::forward<Containers>(containers)...);
+}
+
+
+
+
+/** @brief Single pass range reading values of type @p T from a stream, through @c std::istream_iterator
+
+    Zipping single pass ranges gives a single pass handy::Zip, which ends as soon as any of them ends.
+    Each value is read once, with no buffering, so several files can be parsed in lockstep:
+
+    @code{.cpp}
+    std::ifstream ids("ids.txt"), prices("prices.txt");
+
+    handy::forEach(handy::istreamRange<int>(ids), handy::istreamRange<double>(prices), [&](int id, double price)
+    {
+        table[id] = price;
+    });
+    @endcode
+
+    The first value is read when #begin() is called, so it must be called only once.
+*/
+template <typename T, class CharT = char, class Traits = std::char_traits<CharT>>
+class IStreamRange
+{
+public:
+
+    using iterator = std::istream_iterator<T, CharT, Traits>;
+    using const_iterator = iterator;
+    using value_type = T;
+
+
+    IStreamRange (std::basic_istream<CharT, Traits>& stream) : stream(&stream) {}
+
+
+    iterator begin () const { return iterator(*stream); }
+
+    iterator end () const { return iterator(); }
+
+
+private:
+
+    std::basic_istream<CharT, Traits>* stream;     ///< The stream read
+};
+
+
+/// Creates a handy::IStreamRange reading from @p stream
+template <typename T, class CharT, class Traits>
+auto istreamRange (std::basic_istream<CharT, Traits>& stream)
+{
+    return IStreamRange<T, CharT, Traits>(stream);
+}
+
+
+
+
 /** @brief Call handy::zipIter() with the begin of each container argument
     
     These are facilities for calling handy::zipIter() more easily. 
@@ -434,11 +868,23 @@ auto zipBegin (T&& t, Containers&&... containers)
 
 /** @brief Call handy::zipIter() with the end of each container argument
     @copydetails zipBegin()
+
+    The end of a pointer is its begin plus the size of the first container, which must then be known.
 */
 template <typename T, typename... Containers, std::enable_if_t< !std::is_pointer< T >::value, int > = 0>
 auto zipEnd (T&& t, Containers&&... containers)
 {
-    return zipIter(impl::zip::end(std::forward<T>(t)), impl::zip::end(std::forward<Containers>(containers))...);
+    constexpr bool pointers = !And_v< !std::is_pointer< std::decay_t< Containers > >::value... >;
+
+    static_assert(!pointers || impl::zip::IsSized< std::remove_reference_t< T > >::value,
+                  "The end of a pointer is given by the size of the first container, which must be known");
+
+    std::size_t length = 0;
+
+    if constexpr(pointers && impl::zip::IsSized< std::remove_reference_t< T > >::value)
+        length = std::size( t );
+
+    return zipIter(impl::zip::end(std::forward<T>(t)), impl::zip::end(std::forward<Containers>(containers), length)...);
 }
 
 /** @brief Call handy::zipIter() with the begin and end of each container argument, returning a std::pair of handy::zipIter()
@@ -529,6 +975,33 @@ decltype(auto) unZip (Tuple&& tup, Function function)
 
 
 
+namespace impl
+{
+namespace zip
+{
+/// Tells if the elements of the range @p R are already zipped, as the ones of a handy::Zip
+template <typename R, typename = void>
+struct IsZipped : std::false_type {};
+
+template <typename R>
+struct IsZipped<R, std::enable_if_t< IsSpecialization< std::decay_t< decltype( *std::begin( std::declval<R&>() ) ) >, Reference >::value >>
+    : std::true_type {};
+
+
+/// The zip of @p containers, or a copy of the single argument if its elements are already zipped
+template <typename... Containers>
+auto zipped (Containers&&... containers)
+{
+    if constexpr(sizeof...(Containers) == 1 && IsZipped< std::decay_t< GetArg_t< 0, Containers... > > >::value)
+        return std::decay_t< GetArg_t< 0, Containers... > >(containers...);
+
+    else
+        return handy::zip(std::forward<Containers>(containers)...);
+}
+} // namespace zip
+} // namespace impl
+
+
 /** @brief For range loop 
     
     This function makes a call to the for range loop unpacking the parameters with the handy::unZip() 
@@ -543,7 +1016,7 @@ void forEach (Args&&... args)
 {
     reverseArgs<sizeof...(Args)-1>([](auto apply, auto&&... elems)
     {
-        for(auto&& tup : zip(std::forward<decltype(elems)>(elems)...))
+        for(auto&& tup : impl::zip::zipped(std::forward<decltype(elems)>(elems)...))
         {
             unZip(std::forward<decltype(tup)>(tup), apply);
         }
@@ -552,6 +1025,259 @@ void forEach (Args&&... args)
 }
 
 
+/** @brief Parallel for range loop
+    
+    The same as handy::forEach(), but the index space is split into tasks of @p policy.grain elements,
+    executed by the threads of handy::threadPool(). All the containers must be random access, and the
+    function must be safe to call concurrently for different elements.
+
+    If the function throws, the remaining tasks are skipped and the first exception is rethrown.
+
+    @code{.cpp}
+    handy::forEach(handy::par, x, y, z, [](double a, double b, double& c){ c = a * b; });
+
+    handy::forEach(handy::par(4096), x, y, z, f);   // Tasks of 4096 elements
+    @endcode
+*/
+template <typename... Args>
+void forEach (ParallelPolicy policy, Args&&... args)
+{
+    reverseArgs<sizeof...(Args)-1>([policy](const auto& apply, auto&&... elems)
+    {
+        auto zipped = impl::zip::zipped(std::forward<decltype(elems)>(elems)...);
+
+        static_assert(std::is_same<typename decltype(zipped)::iterator_category, std::random_access_iterator_tag>::value,
+                      "The parallel handy::forEach needs random access containers");
+
+        auto first = zipped.begin();
+
+        std::size_t n = zipped.size(), grain = policy.grainFor(n);
+
+        threadPool().run((n + grain - 1) / grain, [&](std::size_t t)
+        {
+            auto it = first + std::ptrdiff_t(t * grain);
+
+            for(std::size_t i = t * grain; i < std::min(n, (t + 1) * grain); ++i, ++it)
+                unZip(*it, apply);
+        });
+
+    }, std::forward<Args>(args)...);
+}
+
+
+namespace impl
+{
+
+namespace zip
+{
+
+/** @brief A view of @p N contiguous elements, or of a runtime number of them if @p N is zero
+
+    The size of the full batches of impl::zip::Batched is a compile time constant, so a loop from @c 0
+    to #size() has a known trip count, and the compiler can fully unroll or vectorize it.
+*/
+template <typename T, std::size_t N>
+class Span
+{
+public:
+
+    using value_type = std::remove_const_t<T>;
+    using iterator = T*;
+    using const_iterator = T*;
+
+
+    /// A span of @p N elements starting at @p ptr
+    template <std::size_t M = N, std::enable_if_t< (M > 0), int > = 0>
+    Span (T* ptr) : ptr(ptr) {}
+
+    /// A span of @p n elements starting at @p ptr
+    template <std::size_t M = N, std::enable_if_t< (M == 0), int > = 0>
+    Span (T* ptr, std::size_t n) : ptr(ptr), n(n) {}
+
+
+    /// Number of elements
+    constexpr std::size_t size () const
+    {
+        if constexpr(N > 0)
+            return N;
+
+        else
+            return n;
+    }
+
+    T& operator [] (std::size_t pos) const { return ptr[pos]; }
+
+    T* data () const { return ptr; }
+
+    T* begin () const { return ptr; }
+
+    T* end () const { return ptr + size(); }
+
+
+private:
+
+    T* ptr;     ///< The first element
+
+    std::conditional_t< (N > 0), std::integral_constant<std::size_t, N>, std::size_t > n{};   ///< Number of elements, if @p N is zero
+};
+
+
+
+/** @brief Batched iteration over contiguous zipped containers, returned by handy::Zip::batched()
+
+    @tparam W Number of elements in each batch
+    @tparam Ptrs The pointers to the memory of each container
+
+    Iterating over it gives, for each of the <tt>size() / W</tt> full batches, a std::tuple with a
+    Span<T, W> of each container. The remaining elements are given by #tail, as a handy::Zip. Ex:
+
+    @code{.cpp}
+    auto b = handy::zip(x, y).batched<8>();
+
+    for(auto [xs, ys] : b)
+        for(std::size_t k = 0; k < xs.size(); ++k)   // xs.size() is 8, known at compile time
+            ys[k] += 2 * xs[k];
+
+    for(auto&& [x1, y1] : b.tail())
+        y1 += 2 * x1;
+    @endcode
+
+    Or, with a single function receiving the spans of the batches and the spans (of runtime size) of the tail:
+
+    @code{.cpp}
+    handy::zip(x, y).batched<8>().forEach([](auto xs, auto ys)
+    {
+        for(std::size_t k = 0; k < xs.size(); ++k)
+            ys[k] += 2 * xs[k];
+    });
+    @endcode
+*/
+template <std::size_t W, typename... Ptrs>
+class Batched
+{
+public:
+
+    static_assert(W > 0, "The batch size must be positive");
+
+
+    /// The tuple of spans of a full batch
+    using value_type = std::tuple< Span< std::remove_pointer_t< Ptrs >, W >... >;
+
+
+    /// Iterator over the full batches
+    class iterator
+    {
+    public:
+
+        using value_type = typename Batched::value_type;
+        using reference = value_type;
+        using pointer = void;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::input_iterator_tag;
+
+
+        iterator (const Batched& batched, std::size_t pos) : batched(&batched), pos(pos) {}
+
+        value_type operator * () const { return batched->batch(pos); }
+
+        iterator& operator ++ () { ++pos; return *this; }
+
+        iterator operator ++ (int) { iterator temp{*this}; ++pos; return temp; }
+
+        bool operator == (const iterator& iter) const { return pos == iter.pos; }
+
+        bool operator != (const iterator& iter) const { return pos != iter.pos; }
+
+
+    private:
+
+        const Batched* batched;     ///< The batches
+
+        std::size_t pos;            ///< The index of the batch
+    };
+
+
+
+    Batched (std::size_t n, Ptrs... ptrs) : n(n), ptrs(ptrs...) {}
+
+
+    /// Number of full batches
+    std::size_t size () const { return n / W; }
+
+
+    /** @name
+        @brief Iteration over the full batches
+    */
+    //@{
+    iterator begin () const { return iterator(*this, 0); }
+
+    iterator end () const { return iterator(*this, size()); }
+    //@}
+
+
+    /// The tuple of spans of the batch @p b
+    value_type batch (std::size_t b) const
+    {
+        return batch(b, std::index_sequence_for<Ptrs...>());
+    }
+
+
+    /// A handy::Zip over the elements after the last full batch, for scalar iteration
+    auto tail () const
+    {
+        return tail(std::index_sequence_for<Ptrs...>());
+    }
+
+
+    /** @brief Calls @p f with the spans of each full batch, and then with the spans of the tail, if not empty
+
+        @param f A function taking a Span of each container. It is called both with the Span<T, W> of the
+                 full batches and with the Span<T, 0> of the tail
+    */
+    template <class F>
+    void forEach (F f) const
+    {
+        for(std::size_t b = 0; b < size(); ++b)
+            handy::unZip(batch(b), f);
+
+        if(n % W)
+            handy::unZip(tailSpans(std::index_sequence_for<Ptrs...>()), f);
+    }
+
+
+
+private:
+
+    template <std::size_t... Is>
+    value_type batch (std::size_t b, std::index_sequence<Is...>) const
+    {
+        return value_type( std::get<Is>(ptrs) + b * W... );
+    }
+
+    template <std::size_t... Is>
+    auto tailSpans (std::index_sequence<Is...>) const
+    {
+        return std::make_tuple( Span< std::remove_pointer_t< Ptrs >, 0 >(std::get<Is>(ptrs) + size() * W, n % W)... );
+    }
+
+    template <std::size_t... Is>
+    auto tail (std::index_sequence<Is...>) const
+    {
+        return handy::zip( Span< std::remove_pointer_t< Ptrs >, 0 >(std::get<Is>(ptrs) + size() * W, n % W)... );
+    }
+
+
+    std::size_t n;                  ///< Total number of elements
+
+    std::tuple< Ptrs... > ptrs;     ///< The memory of each container
+};
+
+} // namespace zip
+
+} // namespace impl
+
+
+
 } // namespace handy
 
 //@}
@@ -0,0 +1,104 @@
+#include <vector>
+#include <list>
+#include <random>
+#include <numeric>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+#include "handy/Algorithms/Parallel.h"
+#include "handy/Container/Container.h"
+
+
+namespace
+{
+	TEST(ParallelAlgorithmsTest, Chunks)
+	{
+		alignas(64) static double buffer[100000];
+
+		for(std::size_t offset : {0, 1, 5, 8})
+			for(std::size_t n : {0, 1, 7, 8192, 8193, 30000, 99990})
+			{
+				handy::impl::parallel::Chunks<double> chunks(n, buffer + offset);
+
+				EXPECT_EQ(chunks.begin(0), 0);
+				EXPECT_EQ(chunks.begin(chunks.count()), n);
+
+				for(std::size_t k = 1; k < chunks.count(); ++k)
+				{
+					EXPECT_LT(chunks.begin(k - 1), chunks.begin(k));
+					EXPECT_EQ(std::uintptr_t(buffer + offset + chunks.begin(k)) % 64, 0);
+				}
+			}
+	}
+
+
+	TEST(ParallelAlgorithmsTest, FillTransform)
+	{
+		handy::Container<int> a(500, 301), b(500, 301);
+
+		auto& ra = handy::parallelFill(a, 3);
+
+		EXPECT_EQ(&ra, &a);
+		EXPECT_TRUE(std::all_of(a.begin(), a.end(), [](int x){ return x == 3; }));
+
+		std::iota(a.begin(), a.end(), 0);
+
+		handy::parallelTransform(a, b, [](int x){ return 2 * x; });
+
+		for(std::size_t i = 0; i < a.size(); ++i)
+			ASSERT_EQ(b[i], 2 * a[i]);
+
+		std::vector<long long> c(a.size());
+
+		handy::parallelTransform(a, b, c, [](int x, int y) -> long long { return x + y; });
+
+		for(std::size_t i = 0; i < a.size(); ++i)
+			ASSERT_EQ(c[i], 3 * a[i]);
+	}
+
+
+	TEST(ParallelAlgorithmsTest, Reduce)
+	{
+		std::vector<int> v(123457);
+
+		std::mt19937 gen(42);
+
+		for(auto& x : v)
+			x = std::uniform_int_distribution<>(-1000, 1000)(gen);
+
+		EXPECT_EQ(handy::parallelReduce(v, 0ll), std::accumulate(v.begin(), v.end(), 0ll));
+		EXPECT_EQ(handy::parallelMin(v), *std::min_element(v.begin(), v.end()));
+		EXPECT_EQ(handy::parallelMax(v), *std::max_element(v.begin(), v.end()));
+
+		EXPECT_EQ(handy::parallelReduce(std::vector<int>{}, 10), 10);
+		EXPECT_EQ(handy::parallelReduce(std::vector<int>{1, 2, 3, 4}, 1, std::multiplies<>()), 24);
+
+
+		// The result only depends on the chunks, never on the threads
+		std::vector<float> f(v.begin(), v.end());
+
+		for(auto& x : f)
+			x /= 7.0f;
+
+		handy::impl::parallel::Chunks<float> chunks(f.size(), f.data());
+
+		float expected = 0.5f;
+
+		for(std::size_t k = 0; k < chunks.count(); ++k)
+			expected += std::accumulate(f.begin() + chunks.begin(k) + 1, f.begin() + chunks.begin(k + 1), f[chunks.begin(k)]);
+
+		EXPECT_EQ(handy::parallelReduce(f, 0.5f), expected);
+	}
+
+
+	TEST(ParallelAlgorithmsTest, Exception)
+	{
+		std::vector<int> v(1 << 20), w(1 << 20);
+
+		v[v.size() / 2] = 1;
+
+		EXPECT_THROW(handy::parallelTransform(v, w, [](int x){ if(x) throw std::runtime_error("x"); return x; }),
+					 std::runtime_error);
+	}
+
+} // namespace
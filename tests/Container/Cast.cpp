@@ -0,0 +1,143 @@
+#include <vector>
+#include <numeric>
+#include <limits>
+#include <cstdint>
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "handy/Container/Cast.h"
+#include "handy/Container/ContainerView.h"
+
+
+namespace
+{
+	template <typename T>
+	handy::Container<T> make (std::initializer_list<T> il)
+	{
+		handy::Container<T> c(il.size());
+
+		std::copy(il.begin(), il.end(), c.begin());
+
+		return c;
+	}
+
+
+	TEST(CastTest, Shape)
+	{
+		handy::Container<std::uint8_t> img(4, 5, 3);
+
+		std::iota(img.begin(), img.end(), 0);
+
+		auto f = handy::cast<float>(img);
+
+		static_assert(std::is_same<decltype(f), handy::Container<float>>::value, "");
+
+		EXPECT_EQ(f.numDimensions(), 3);
+		EXPECT_EQ(f.size(0), 4);
+		EXPECT_EQ(f.size(1), 5);
+		EXPECT_EQ(f.size(2), 3);
+
+		for(int i = 0; i < 4; ++i)
+			for(int j = 0; j < 5; ++j)
+				for(int k = 0; k < 3; ++k)
+					EXPECT_EQ(f(i, j, k), float(img(i, j, k)));
+
+
+		handy::Container<double, 2, 3> s = {0.5, 1.5, 2.5, -0.5, -1.5, 1e10};
+
+		auto t = handy::cast<int, handy::conv::Nearest, handy::conv::Saturate>(s);
+
+		static_assert(std::is_same<decltype(t), handy::Container<int, 2, 3>>::value, "");
+
+		EXPECT_EQ(t(0, 0), 0);
+		EXPECT_EQ(t(0, 1), 2);
+		EXPECT_EQ(t(0, 2), 2);
+		EXPECT_EQ(t(1, 0), 0);
+		EXPECT_EQ(t(1, 1), -2);
+		EXPECT_EQ(t(1, 2), std::numeric_limits<int>::max());
+
+
+		std::vector<short> buffer = {1, 2, 3, 4, 5, 6};
+
+		auto v = handy::cast<double>(handy::view(buffer.data(), 3, 2));
+
+		EXPECT_EQ(v.size(0), 3);
+		EXPECT_EQ(v(2, 1), 6.0);
+	}
+
+
+	TEST(CastTest, Rounding)
+	{
+		auto c = make({-2.5f, -1.7f, -0.2f, 0.2f, 1.5f, 1.7f});
+
+		auto toVec = [](const auto& x){ return std::vector<int>(x.begin(), x.end()); };
+
+		EXPECT_EQ(toVec(handy::cast<int>(c)), (std::vector<int>{-2, -1, 0, 0, 1, 1}));
+		EXPECT_EQ(toVec(handy::cast<int, handy::conv::Nearest>(c)), (std::vector<int>{-2, -2, 0, 0, 2, 2}));
+		EXPECT_EQ(toVec(handy::cast<int, handy::conv::Floor>(c)), (std::vector<int>{-3, -2, -1, 0, 1, 1}));
+		EXPECT_EQ(toVec(handy::cast<int, handy::conv::Ceil>(c)), (std::vector<int>{-2, -1, 0, 1, 2, 2}));
+	}
+
+
+	TEST(CastTest, Saturate)
+	{
+		using Sat = handy::conv::Saturate;
+		using Trunc = handy::conv::Truncate;
+
+		auto i = make({-1000, -129, -128, 0, 127, 128, 1000});
+
+		auto s8 = handy::cast<std::int8_t, Trunc, Sat>(i);
+		auto u8 = handy::cast<std::uint8_t, Trunc, Sat>(i);
+
+		EXPECT_EQ(std::vector<int>(s8.begin(), s8.end()), (std::vector<int>{-128, -128, -128, 0, 127, 127, 127}));
+		EXPECT_EQ(std::vector<int>(u8.begin(), u8.end()), (std::vector<int>{0, 0, 0, 0, 127, 128, 255}));
+
+
+		auto u = make({0u, 5u, 4000000000u});
+
+		auto s32 = handy::cast<std::int32_t, Trunc, Sat>(u);
+
+		EXPECT_EQ(s32[1], 5);
+		EXPECT_EQ(s32[2], std::numeric_limits<std::int32_t>::max());
+
+
+		auto d = make({-1e300, std::nan(""), 3e9, 1e300, 0.5});
+
+		auto di = handy::cast<std::int32_t, Trunc, Sat>(d);
+
+		EXPECT_EQ(di[0], std::numeric_limits<std::int32_t>::min());
+		EXPECT_EQ(di[1], 0);
+		EXPECT_EQ(di[2], std::numeric_limits<std::int32_t>::max());
+
+		auto df = handy::cast<float, Trunc, Sat>(d);
+
+		EXPECT_EQ(df[0], std::numeric_limits<float>::lowest());
+		EXPECT_EQ(df[3], std::numeric_limits<float>::max());
+		EXPECT_EQ(df[4], 0.5f);
+	}
+
+
+	TEST(CastTest, Into)
+	{
+		handy::Container<int> src(1000, 300);
+
+		std::iota(src.begin(), src.end(), -150000);
+
+		handy::Container<std::int16_t> dst(1000, 300);
+
+		auto& res = handy::castInto<handy::conv::Truncate, handy::conv::Saturate>(src, dst);
+
+		EXPECT_EQ(&res, &dst);
+
+		for(std::size_t k = 0; k < src.size(); ++k)
+			ASSERT_EQ(dst[k], std::max(-32768, std::min(32767, src[k])));
+
+
+		std::vector<double> out(src.size());
+
+		handy::castInto(src, out);
+
+		EXPECT_TRUE(std::equal(src.begin(), src.end(), out.begin()));
+	}
+
+} // namespace
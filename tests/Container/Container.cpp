@@ -1,6 +1,7 @@
 #include <list>
 #include <set>
 #include <random>
+#include <cstdlib>
 
 #include "gtest/gtest.h"
 #include "handy/Container/Container.h"
@@ -101,5 +102,30 @@ namespace
 	}
 
 
-} // namespace
+	/// Indices past 2^31 elements. It allocates 3GB, so it only runs if HANDY_LARGE_TESTS is set
+	TEST(ContainerTest, LargeIndex)
+	{
+		if(!std::getenv("HANDY_LARGE_TESTS"))
+			GTEST_SKIP();
+
+		const std::size_t n = std::size_t(1) << 30;
+
+		handy::Container<char> c(3, n);
+
+		c[3 * n - 1] = 7;
+
+		auto slc = c.slice(2);
 
+
+		EXPECT_EQ(c.size(), 3 * n);
+		EXPECT_EQ(c(2, n - 1), 7);
+		EXPECT_EQ(c({std::size_t(2), n - 1}), 7);
+
+		EXPECT_EQ(slc.size(), n);
+		EXPECT_EQ(slc[n - 1], 7);
+		EXPECT_EQ(slc(n - 1), 7);
+		EXPECT_EQ(std::size_t(&*slc.begin() - &c[0]), 2 * n);
+	}
+
+
+} // namespace
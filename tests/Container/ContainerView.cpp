@@ -0,0 +1,159 @@
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+#include "handy/Container/ContainerView.h"
+#include "handy/Container/SummedAreaTable.h"
+#include "handy/Container/Cast.h"
+#include "handy/Algorithms/Algorithms.h"
+
+
+namespace
+{
+	TEST(ContainerViewTest, Access)
+	{
+		std::vector<int> buffer(4 * 5 * 6);
+
+		std::iota(buffer.begin(), buffer.end(), 0);
+
+		handy::Container<int> c(4, 5, 6);
+
+		std::copy(buffer.begin(), buffer.end(), c.begin());
+
+
+		handy::ContainerView<int> a(buffer.data(), 4, 5, 6);
+		handy::ContainerView<int> b(buffer.data(), {4, 5, 6});
+		auto v = handy::view(buffer.data(), std::vector<int>{4, 5, 6});
+
+		int arr[] = {3, 2, 1};
+
+		EXPECT_EQ(a.size(), c.size());
+		EXPECT_EQ(a.numDimensions(), 3);
+		EXPECT_TRUE(a.isContiguous());
+
+		for(int i = 0; i < 4; ++i)
+			for(int j = 0; j < 5; ++j)
+				for(int k = 0; k < 6; ++k)
+				{
+					EXPECT_EQ(a(i, j, k), c(i, j, k));
+					EXPECT_EQ(b({i, j, k}), c(i, j, k));
+					EXPECT_EQ(v(std::vector<int>{i, j}, k), c(i, j, k));
+				}
+
+		EXPECT_EQ(a(&arr[0]), c(&arr[0]));
+
+
+		a(1, 2, 3) = -1;
+
+		EXPECT_EQ(buffer[1 * 30 + 2 * 6 + 3], -1);
+	}
+
+
+
+	TEST(ContainerViewTest, Slice)
+	{
+		std::vector<double> buffer(3 * 4 * 5);
+
+		std::iota(buffer.begin(), buffer.end(), 0.0);
+
+		const auto& cref = buffer;
+
+		handy::ContainerView<const double> a(cref.data(), 3, 4, 5);
+
+		auto slc = a.slice(2, 1);
+
+		EXPECT_EQ(slc.size(), 5);
+		EXPECT_EQ(slc(3), a(2, 1, 3));
+		EXPECT_TRUE(std::equal(slc.cbegin(), slc.cend(), buffer.begin() + 45));
+	}
+
+
+
+	TEST(ContainerViewTest, Strided)
+	{
+		std::vector<int> buffer(6 * 8);
+
+		std::iota(buffer.begin(), buffer.end(), 0);
+
+		// Columns 2 to 5 of a 6 x 8 row major matrix, transposed
+		handy::ContainerView<int> t(buffer.data() + 2, {4, 6}, {1, 8});
+
+		EXPECT_FALSE(t.isContiguous());
+
+		for(int i = 0; i < 4; ++i)
+			for(int j = 0; j < 6; ++j)
+				EXPECT_EQ(t(i, j), buffer[j * 8 + i + 2]);
+
+		EXPECT_EQ(t.slice(3)(5), buffer[5 * 8 + 5]);
+
+
+		// Transpose of a 4 x 6 row major matrix
+		std::vector<int> m(4 * 6);
+
+		std::iota(m.begin(), m.end(), 0);
+
+		handy::ContainerView<int> tr(m.data(), {6, 4}, {1, 6});
+
+		EXPECT_EQ(tr(3, 1), 9);
+		EXPECT_EQ(tr[5], 7);
+
+		auto col = tr.slice(3);
+
+		EXPECT_EQ(col.size(), 4);
+		EXPECT_EQ(col.numDimensions(), 1);
+		EXPECT_FALSE(col.isContiguous());
+		EXPECT_EQ(col(2), 15);
+		EXPECT_EQ(tr.slice({3, 2})[0], 15);
+		EXPECT_EQ(tr.slice(std::vector<int>{5}).size(), 4);
+
+		std::vector<int> elems;
+
+		for(std::size_t i = 0; i < col.size(); ++i)
+			elems.push_back(col[i]);
+
+		EXPECT_EQ(elems, (std::vector<int>{3, 9, 15, 21}));
+
+		// Iterators are pointers, so they are refused for strided views
+		EXPECT_THROW(col.begin(), std::logic_error);
+		EXPECT_THROW(handy::accumulate(tr, 0), std::logic_error);
+
+
+		auto casted = handy::cast<double>(tr);
+
+		EXPECT_EQ(casted.size(0), 6);
+		EXPECT_EQ(casted(3, 1), 9.0);
+		EXPECT_EQ(casted(5, 3), 23.0);
+
+		handy::SummedAreaTable<long> sat(tr);
+
+		EXPECT_EQ(sat.sum({1, 1}, {3, 3}), 7 + 13 + 8 + 14);
+
+		m[2 * 6 + 1] = 100;
+		sat.update(tr, {1, 2}, {2, 3});
+
+		EXPECT_EQ(sat.sum({1, 1}, {3, 3}), 7 + 100 + 8 + 14);
+	}
+
+
+
+	TEST(ContainerViewTest, Algorithms)
+	{
+		handy::Container<int> c(7, 9);
+
+		std::iota(c.begin(), c.end(), 0);
+
+		auto v = handy::view(c);
+
+		handy::reverse(v);
+
+		EXPECT_EQ(c(0, 0), 62);
+		EXPECT_EQ(handy::accumulate(v, 0), 62 * 63 / 2);
+
+		handy::SummedAreaTable sat(v);
+
+		EXPECT_EQ(sat.sum({0, 0}, {7, 9}), 62 * 63 / 2);
+	}
+
+} // namespace
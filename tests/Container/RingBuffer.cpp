@@ -0,0 +1,99 @@
+#include <vector>
+#include <deque>
+#include <numeric>
+
+#include "gtest/gtest.h"
+#include "handy/Container/RingBuffer.h"
+
+
+namespace
+{
+	TEST(RingBufferTest, Creation)
+	{
+		handy::RingBuffer<int> a(5, 3, 2);
+		handy::RingBuffer<int, 5, 3, 2> b;
+
+		EXPECT_EQ(a.capacity(), 5);
+		EXPECT_EQ(b.capacity(), 5);
+		EXPECT_EQ(a.rowSize(), 6);
+		EXPECT_EQ(b.rowSize(), 6);
+
+		EXPECT_TRUE(a.empty());
+		EXPECT_TRUE(b.empty());
+		EXPECT_EQ(a.size(), 30);
+	}
+
+
+
+	TEST(RingBufferTest, Access)
+	{
+		handy::RingBuffer<int> rb(4, 2, 3);
+
+		std::deque<std::vector<int>> reference;
+
+		for(int i = 0; i < 11; ++i)
+		{
+			std::vector<int> row(6);
+
+			std::iota(row.begin(), row.end(), 10 * i);
+
+			rb.push_back(row);
+			reference.push_back(row);
+
+			if(reference.size() > rb.capacity())
+				reference.pop_front();
+
+
+			EXPECT_EQ(rb.rows(), reference.size());
+
+			for(std::size_t r = 0; r < reference.size(); ++r)
+			{
+				EXPECT_EQ(rb(r, 1, 2), reference[r][5]);
+				EXPECT_EQ(rb({r, std::size_t(0), std::size_t(1)}), reference[r][1]);
+				EXPECT_EQ(rb(std::vector<std::size_t>{r, 1, 0}), reference[r][3]);
+
+				auto slc = rb.slice(r);
+
+				EXPECT_EQ(std::vector<int>(slc.begin(), slc.end()), reference[r]);
+				EXPECT_EQ(rb.slice(r, 1)(2), reference[r][5]);
+			}
+		}
+
+		EXPECT_TRUE(rb.full());
+
+		rb.clear();
+
+		EXPECT_TRUE(rb.empty());
+	}
+
+
+
+	TEST(RingBufferTest, Window)
+	{
+		handy::RingBuffer<int, 5> rb;
+
+		for(int i = 0; i < 3; ++i)
+			rb.push_back(i);
+
+		auto [a, b] = rb.window();
+
+		EXPECT_EQ(std::vector<int>(a.begin(), a.end()), std::vector<int>({0, 1, 2}));
+		EXPECT_EQ(b.size(), 0);
+
+
+		for(int i = 3; i < 8; ++i)
+			rb.push_back(i);
+
+		auto [c, d] = rb.window();
+
+		EXPECT_EQ(std::vector<int>(c.begin(), c.end()), std::vector<int>({3, 4}));
+		EXPECT_EQ(std::vector<int>(d.begin(), d.end()), std::vector<int>({5, 6, 7}));
+
+		EXPECT_EQ(c(1), 4);
+		EXPECT_EQ(d(2), 7);
+
+		for(int i = 0; i < 5; ++i)
+			EXPECT_EQ(rb(i), i + 3);
+	}
+
+} // namespace
@@ -52,6 +52,13 @@ namespace
 		EXPECT_EQ(d(std::set<int, std::greater<int>>{5, 2}), x);
 		EXPECT_EQ(e(2), x);
 		EXPECT_EQ(f(0), x);
+
+		int arr[] = {0, 5, 2};
+
+		EXPECT_EQ(c(&arr[0]), x);
+		EXPECT_EQ(c({0, 5, 2}), x);
+
+		static_assert(std::is_same<decltype(c.size()), std::size_t>::value, "");
 	}
 
 
@@ -0,0 +1,119 @@
+#include <array>
+#include <random>
+
+#include "gtest/gtest.h"
+#include "handy/Container/SmallMatrix.h"
+
+
+namespace
+{
+	struct SmallMatrixTest : public ::testing::Test
+	{
+		template <class Cnt>
+		void randomize (Cnt& c)
+		{
+			for(auto& x : c)
+				x = std::uniform_real_distribution<>(-10.0, 10.0)(gen);
+		}
+
+
+		template <std::size_t N>
+		void checkInverse ()
+		{
+			handy::Container<double, N, N> a;
+
+			randomize(a);
+
+			auto id = handy::multiply(a, handy::inverse(a));
+
+			for(std::size_t i = 0; i < N; ++i)
+				for(std::size_t j = 0; j < N; ++j)
+					EXPECT_NEAR(id(i, j), i == j, 1e-8);
+		}
+
+
+		std::mt19937 gen{7};
+	};
+
+
+
+	TEST_F(SmallMatrixTest, Multiply)
+	{
+		handy::Container<double, 3, 4> a;
+		handy::Container<double, 4, 2> b;
+
+		randomize(a);
+		randomize(b);
+
+		auto c = handy::multiply(a, b);
+
+		static_assert(std::is_same<decltype(c), handy::Container<double, 3, 2>>::value, "");
+
+		for(int i = 0; i < 3; ++i)
+			for(int j = 0; j < 2; ++j)
+			{
+				double res = 0.0;
+
+				for(int k = 0; k < 4; ++k)
+					res += a(i, k) * b(k, j);
+
+				EXPECT_NEAR(c(i, j), res, 1e-10);
+			}
+	}
+
+
+
+	TEST_F(SmallMatrixTest, TransposeDot)
+	{
+		handy::Container<int, 2, 3> a(1, 2, 3, 4, 5, 6);
+
+		auto t = handy::transpose(a);
+
+		for(int i = 0; i < 2; ++i)
+			for(int j = 0; j < 3; ++j)
+				EXPECT_EQ(t(j, i), a(i, j));
+
+		EXPECT_EQ(handy::dot(a, a), 91);
+	}
+
+
+
+	TEST_F(SmallMatrixTest, Determinant)
+	{
+		EXPECT_EQ(handy::determinant(handy::Container<int, 2, 2>(3, 8, 4, 6)), -14);
+		EXPECT_EQ(handy::determinant(handy::Container<int, 3, 3>(6, 1, 1, 4, -2, 5, 2, 8, 7)), -306);
+		EXPECT_EQ(handy::determinant(handy::Container<int, 4, 4>(1, 0, 2, -1, 3, 0, 0, 5, 2, 1, 4, -3, 1, 0, 5, 0)), 30);
+	}
+
+
+
+	TEST_F(SmallMatrixTest, Inverse)
+	{
+		checkInverse<1>();
+		checkInverse<2>();
+		checkInverse<3>();
+		checkInverse<4>();
+	}
+
+
+
+	TEST_F(SmallMatrixTest, Constexpr)
+	{
+		constexpr std::array<int, 4> a = {1, 2, 3, 4};
+		constexpr std::array<int, 6> b = {1, 0, 2, 0, 1, 3};
+
+		static_assert(handy::determinant<2>(a) == -2, "");
+		static_assert(handy::dot(a, a) == 30, "");
+		constexpr auto c = handy::multiply<2, 2, 3>(a, b);
+		constexpr auto t = handy::transpose<2, 3>(b);
+
+		static_assert(c[0] == 1 && c[1] == 2 && c[2] == 8 && c[3] == 3 && c[4] == 4 && c[5] == 18, "");
+		static_assert(t[0] == 1 && t[1] == 0 && t[2] == 0 && t[3] == 1 && t[4] == 2 && t[5] == 3, "");
+
+		constexpr auto inv = handy::inverse<2>(std::array<double, 4>{4.0, 7.0, 2.0, 6.0});
+
+		static_assert(inv[0] > 0.6 - 1e-12 && inv[0] < 0.6 + 1e-12, "");
+		static_assert(inv[1] > -0.7 - 1e-12 && inv[1] < -0.7 + 1e-12, "");
+	}
+
+} // namespace
@@ -0,0 +1,138 @@
+#include <vector>
+#include <random>
+#include <cstdint>
+
+#include "gtest/gtest.h"
+#include "handy/Container/SummedAreaTable.h"
+
+
+namespace
+{
+	struct SummedAreaTableTest : public ::testing::Test
+	{
+		int rng (int l, int u)
+		{
+			return std::uniform_int_distribution<>(l, u - 1)(gen);
+		}
+
+
+		template <class Cnt, class F>
+		void forBoxes (const Cnt& c, int numBoxes, F f)
+		{
+			for(int b = 0; b < numBoxes; ++b)
+			{
+				std::vector<std::size_t> lo(c.numDimensions()), hi(c.numDimensions());
+
+				for(std::size_t p = 0; p < lo.size(); ++p)
+				{
+					lo[p] = rng(0, c.size(p));
+					hi[p] = rng(lo[p] + 1, c.size(p) + 1);
+				}
+
+				f(lo, hi);
+			}
+		}
+
+
+		/// Brute force sum over a 3d box
+		template <class Cnt>
+		long long boxSum (const Cnt& c, const std::vector<std::size_t>& lo, const std::vector<std::size_t>& hi)
+		{
+			long long res = 0;
+
+			for(auto i = lo[0]; i < hi[0]; ++i)
+				for(auto j = lo[1]; j < hi[1]; ++j)
+					for(auto k = lo[2]; k < hi[2]; ++k)
+						res += c(i, j, k);
+
+			return res;
+		}
+
+
+		std::mt19937 gen{42};
+	};
+
+
+
+	TEST_F(SummedAreaTableTest, Sum2d)
+	{
+		handy::Container<std::uint8_t> img(37, 53);
+
+		for(auto& x : img)
+			x = rng(0, 256);
+
+		handy::SummedAreaTable sat(img);
+
+		static_assert(std::is_same<decltype(sat)::value_type, unsigned long long>::value, "");
+
+
+		forBoxes(img, 200, [&](const auto& lo, const auto& hi)
+		{
+			unsigned long long res = 0;
+
+			for(auto i = lo[0]; i < hi[0]; ++i)
+				for(auto j = lo[1]; j < hi[1]; ++j)
+					res += img(i, j);
+
+			EXPECT_EQ(sat.sum(lo, hi), res);
+			EXPECT_DOUBLE_EQ(sat.mean(lo, hi), double(res) / ((hi[0] - lo[0]) * (hi[1] - lo[1])));
+		});
+
+		EXPECT_EQ(sat.sum({0, 0}, {37, 53}), std::accumulate(img.begin(), img.end(), 0ull));
+	}
+
+
+
+	TEST_F(SummedAreaTableTest, Sum3d)
+	{
+		handy::Container<int, 9, 14, 11> c;
+
+		for(auto& x : c)
+			x = rng(-100, 100);
+
+		handy::SummedAreaTable sat(c);
+
+		forBoxes(c, 200, [&](const auto& lo, const auto& hi)
+		{
+			EXPECT_EQ(sat.sum(lo, hi), boxSum(c, lo, hi));
+		});
+	}
+
+
+
+	TEST_F(SummedAreaTableTest, Update)
+	{
+		handy::Container<int> c(12, 7, 15);
+
+		for(auto& x : c)
+			x = rng(-100, 100);
+
+		handy::SummedAreaTable sat(c);
+
+		for(int t = 0; t < 10; ++t)
+		{
+			forBoxes(c, 1, [&](const auto& lo, const auto& hi)
+			{
+				for(auto i = lo[0]; i < hi[0]; ++i)
+					for(auto j = lo[1]; j < hi[1]; ++j)
+						for(auto k = lo[2]; k < hi[2]; ++k)
+							c(i, j, k) = rng(-100, 100);
+
+				sat.update(c, lo, hi);
+			});
+
+			forBoxes(c, 50, [&](const auto& lo, const auto& hi)
+			{
+				EXPECT_EQ(sat.sum(lo, hi), boxSum(c, lo, hi));
+			});
+		}
+
+
+		c(11, 6, 14) = 1000;
+
+		sat.update(c, {11, 6, 14}, {12, 7, 15});
+
+		EXPECT_EQ(sat.sum({11, 6, 14}, {12, 7, 15}), 1000);
+	}
+
+} // namespace
@@ -6,6 +6,8 @@
 #include <sstream>
 
 #include <vector>
+#include <string>
+#include <array>
 
 
 namespace
@@ -47,4 +49,38 @@ TEST(HelpersTest, GetArgTest)
 
 
 
-}
\ No newline at end of file
+TEST(HelpersTest, StaticForTest)
+{
+    EXPECT_TRUE((std::is_same<handy::StaticRange<0, 10, 3>, std::integer_sequence<std::ptrdiff_t, 0, 3, 6, 9>>::value));
+    EXPECT_TRUE((std::is_same<handy::StaticRange<5, 0, -2>, std::integer_sequence<std::ptrdiff_t, 5, 3, 1>>::value));
+    EXPECT_TRUE((std::is_same<handy::StaticRange<3, 3>, std::integer_sequence<std::ptrdiff_t>>::value));
+    EXPECT_TRUE((std::is_same<handy::StaticRange<0, 3, -1>, std::integer_sequence<std::ptrdiff_t>>::value));
+
+
+    std::tuple<int, double, std::string> tup{ 1, 2.5, "a" };
+
+    std::ostringstream os;
+
+    handy::staticFor<3>([&](auto i){ os << std::get<i>(tup) << " "; });
+    handy::staticFor<2, -1, -1>([&](auto i){ os << std::get<i>(tup); });
+
+    EXPECT_EQ(os.str(), "1 2.5 a a2.51");
+
+
+    auto sum = handy::staticApply<1, 4>([](auto... is){ return std::integral_constant<int, (0 + ... + is)>(); });
+
+    std::array<int, decltype(sum)::value> arr{};
+
+    EXPECT_EQ(arr.size(), 6);
+
+
+    handy::applyTuple([](auto& x, int inc){ x += inc; }, tup, 1);
+
+    EXPECT_EQ(tup, std::make_tuple(2, 3.5, std::string("a\x01")));
+
+    EXPECT_EQ(handy::reverseArgs<2>([](auto... xs){ return std::vector<int>{ xs... }; }, 0, 1, 2, 3), (std::vector<int>{2, 3, 0, 1}));
+}
+
+
+
+}
@@ -0,0 +1,187 @@
+#include <vector>
+#include <list>
+#include <string>
+#include <sstream>
+#include <map>
+
+#include "handy/Range/Adaptors.h"
+#include "handy/Range/Parallel.h"
+#include "handy/Algorithms/Algorithms.h"
+#include "handy/ZipIter/ZipIter.h"
+#include "gtest/gtest.h"
+
+
+namespace
+{
+    template <class R>
+    auto toVector (R&& r)
+    {
+        std::vector<std::decay_t<decltype(*std::begin(r))>> v;
+
+        for(auto&& x : r)
+            v.push_back(x);
+
+        return v;
+    }
+
+    template <class R>
+    constexpr bool isRandomAccess = std::is_same<typename std::decay_t<R>::iterator::iterator_category,
+                                                 std::random_access_iterator_tag>::value;
+
+
+    TEST(AdaptorsTest, Map)
+    {
+        auto squares = handy::mapped(handy::range(5), [](int x){ return x * x; });
+
+        EXPECT_EQ(toVector(squares), (std::vector<int>{0, 1, 4, 9, 16}));
+        EXPECT_TRUE(isRandomAccess<decltype(squares)>);
+        EXPECT_EQ(squares.size(), 5);
+        EXPECT_EQ(squares[3], 9);
+        EXPECT_EQ(*(squares.end() - 2), 9);
+
+
+        std::vector<std::string> words = { "a", "bb", "ccc" };
+
+        auto lengths = handy::mapped(words, [](const std::string& s){ return s.size(); });
+
+        words[0] = "dddd";
+
+        EXPECT_EQ(toVector(lengths), (std::vector<std::size_t>{4, 2, 3}));     // Held by reference
+
+
+        std::list<int> l = { 1, 2, 3 };
+
+        auto doubled = handy::mapped(l, [](int& x) -> int& { return x *= 2; });
+
+        EXPECT_FALSE(isRandomAccess<decltype(doubled)>);
+        EXPECT_EQ(toVector(doubled), (std::vector<int>{2, 4, 6}));
+    }
+
+
+    TEST(AdaptorsTest, Filter)
+    {
+        auto odd = handy::filter(handy::range(10), [](int x){ return x % 2; });
+
+        EXPECT_EQ(toVector(odd), (std::vector<int>{1, 3, 5, 7, 9}));
+
+        std::vector<int> v = { 4, -1, 5, -2, -3, 6 };
+
+        for(auto& x : handy::filter(v, [](int x){ return x < 0; }))
+            x = 0;
+
+        EXPECT_EQ(v, (std::vector<int>{4, 0, 5, 0, 0, 6}));
+
+        EXPECT_TRUE(toVector(handy::filter(v, [](int x){ return x > 10; })).empty());
+    }
+
+
+    TEST(AdaptorsTest, Take)
+    {
+        auto t = handy::take(handy::range(100), 3);
+
+        EXPECT_EQ(toVector(t), (std::vector<int>{0, 1, 2}));
+        EXPECT_TRUE(isRandomAccess<decltype(t)>);
+        EXPECT_EQ(t.size(), 3);
+        EXPECT_EQ(handy::take(handy::range(2), 5).size(), 2);
+        EXPECT_EQ(toVector(handy::take(handy::range(2), 5)), (std::vector<int>{0, 1}));
+
+        EXPECT_EQ(toVector(handy::take(handy::irange(10, 5), 4)), (std::vector<int>{10, 15, 20, 25}));
+
+        std::list<int> l = { 1, 2 };
+
+        EXPECT_EQ(toVector(handy::take(l, 5)), (std::vector<int>{1, 2}));
+        EXPECT_EQ(toVector(handy::take(l, 1)), (std::vector<int>{1}));
+
+        std::istringstream is("1 2 3 4");
+
+        EXPECT_EQ(toVector(handy::take(handy::istreamRange<int>(is), 2)), (std::vector<int>{1, 2}));
+    }
+
+
+    TEST(AdaptorsTest, Stride)
+    {
+        std::vector<int> v = { 0, 1, 2, 3, 4, 5, 6 };
+
+        auto s = handy::stride(v, 3);
+
+        EXPECT_EQ(toVector(s), (std::vector<int>{0, 3, 6}));
+        EXPECT_TRUE(isRandomAccess<decltype(s)>);
+        EXPECT_EQ(s.size(), 3);
+        EXPECT_EQ(s[1], 3);
+        EXPECT_EQ(s.end() - s.begin(), 3);
+        EXPECT_EQ(*(s.end() - 1), 6);
+
+        for(auto& x : handy::stride(v, 2))
+            x = -1;
+
+        EXPECT_EQ(v, (std::vector<int>{-1, 1, -1, 3, -1, 5, -1}));
+
+        std::list<int> l = { 0, 1, 2, 3, 4 };
+
+        EXPECT_EQ(toVector(handy::stride(l, 2)), (std::vector<int>{0, 2, 4}));
+        EXPECT_EQ(toVector(handy::take(handy::stride(handy::irange(0), 10), 3)), (std::vector<int>{0, 10, 20}));
+    }
+
+
+    TEST(AdaptorsTest, Concat)
+    {
+        std::vector<int> a = { 1, 2 }, b, c = { 3 };
+        std::list<int> d = { 4, 5 };
+
+        auto all = handy::concat(a, b, c, d);
+
+        EXPECT_EQ(toVector(all), (std::vector<int>{1, 2, 3, 4, 5}));
+        EXPECT_EQ(all.size(), 5);
+
+        for(auto& x : handy::concat(a, d))
+            x *= 10;
+
+        EXPECT_EQ(a, (std::vector<int>{10, 20}));
+        EXPECT_EQ(toVector(handy::concat(b, handy::range(3), std::vector<double>{0.5})), (std::vector<double>{0, 1, 2, 0.5}));
+        EXPECT_TRUE(toVector(handy::concat(b, b)).empty());
+
+
+        std::istringstream s("1 2 3 4"), t("5 6");
+
+        auto streams = handy::concat(handy::istreamRange<int>(s), handy::istreamRange<int>(t));
+
+        EXPECT_TRUE((std::is_same<decltype(streams)::iterator_category, std::input_iterator_tag>::value));
+        EXPECT_EQ(toVector(streams), (std::vector<int>{1, 2, 3, 4, 5, 6}));
+    }
+
+
+    TEST(AdaptorsTest, Composition)
+    {
+        auto chain = handy::range(100) & handy::mapped([](int x){ return 2 * x; }) & handy::stride(10) & handy::take(4);
+
+        EXPECT_EQ(toVector(chain), (std::vector<int>{0, 20, 40, 60}));
+        EXPECT_TRUE(isRandomAccess<decltype(chain)>);
+
+        EXPECT_TRUE(handy::range(100) & handy::filter([](int x){ return x % 7 == 0; }) &
+                    handy::all_of([](int x){ return x % 7 == 0; }));
+
+
+        std::vector<double> w(10, 0.0);
+
+        for(auto&& [x, y] : handy::zip(handy::mapped(handy::range(10), [](int i){ return i * 0.5; }), w))
+            y = x;
+
+        EXPECT_EQ(w[9], 4.5);
+
+
+        long sum = handy::parallelFor(handy::stride(handy::range(1000), 3), handy::reduction(0L), [](int i, long& acc){ acc += i; });
+
+        EXPECT_EQ(sum, 166833);
+    }
+
+
+    TEST(AdaptorsTest, StandardNames)
+    {
+        using namespace std;
+        using namespace handy;
+
+        map<int, int> m = { {1, 2} };
+
+        EXPECT_EQ(toVector(mapped(m, [](const pair<const int, int>& p){ return p.second; })), (vector<int>{2}));
+    }
+}
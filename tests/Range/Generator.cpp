@@ -0,0 +1,183 @@
+#include "handy/Range/Generator.h"
+
+#ifdef __cpp_impl_coroutine
+
+#include <vector>
+#include <string>
+#include <sstream>
+#include <stdexcept>
+#include <memory>
+
+#include "handy/Range/Adaptors.h"
+#include "handy/ZipIter/ZipIter.h"
+#include "gtest/gtest.h"
+
+
+namespace
+{
+    handy::Generator<int> iota (int first, int last)
+    {
+        for(int i = first; i < last; ++i)
+            co_yield i;
+    }
+
+    handy::Generator<long> fibonacci ()
+    {
+        for(long a = 0, b = 1;; a = std::exchange(b, a + b))
+            co_yield a;
+    }
+
+    handy::Generator<std::string> lines (std::istream& is)
+    {
+        for(std::string line; std::getline(is, line);)
+            co_yield line;
+    }
+
+    /// The numbers from 0 to 2^depth - 1, in order, through nested generators
+    handy::Generator<int> tree (int depth, int offset = 0)
+    {
+        if(depth == 0)
+            co_yield offset;
+
+        else
+        {
+            co_yield handy::elementsOf(tree(depth - 1, offset));
+            co_yield handy::elementsOf(tree(depth - 1, offset + (1 << (depth - 1))));
+        }
+    }
+
+    handy::Generator<int> throwing (int n)
+    {
+        for(int i = 0; i < n; ++i)
+            co_yield i;
+
+        throw std::runtime_error("done");
+    }
+
+    handy::Generator<std::unique_ptr<int>&> owners (std::vector<std::unique_ptr<int>>& v)
+    {
+        for(auto& p : v)
+            co_yield p;
+    }
+
+
+    TEST(GeneratorTest, Iteration)
+    {
+        std::vector<int> v;
+
+        for(int x : iota(2, 6))
+            v.push_back(x);
+
+        EXPECT_EQ(v, (std::vector<int>{2, 3, 4, 5}));
+
+        auto empty = iota(3, 3);
+
+        EXPECT_TRUE(empty.begin() == empty.end());
+
+
+        std::istringstream is("a\nbb\nccc");
+
+        std::vector<std::string> read;
+
+        for(const auto& line : lines(is))
+            read.push_back(line);
+
+        EXPECT_EQ(read, (std::vector<std::string>{ "a", "bb", "ccc" }));
+
+
+        std::vector<std::unique_ptr<int>> ptrs;
+
+        ptrs.push_back(std::make_unique<int>(1));
+
+        for(auto& p : owners(ptrs))
+            p = std::make_unique<int>(*p + 10);
+
+        EXPECT_EQ(*ptrs[0], 11);
+    }
+
+
+    TEST(GeneratorTest, Nested)
+    {
+        std::vector<int> v;
+
+        for(int x : tree(10))
+            v.push_back(x);
+
+        ASSERT_EQ(v.size(), 1024);
+
+        for(int i = 0; i < 1024; ++i)
+            EXPECT_EQ(v[i], i);
+    }
+
+
+    TEST(GeneratorTest, Exceptions)
+    {
+        int count = 0;
+
+        EXPECT_THROW(for(int x : throwing(3)) count += x, std::runtime_error);
+        EXPECT_EQ(count, 3);
+
+        auto caught = []() -> handy::Generator<int>
+        {
+            bool failed = false;
+
+            try
+            {
+                co_yield handy::elementsOf(throwing(2));
+            }
+            catch(const std::runtime_error&)
+            {
+                failed = true;
+            }
+
+            if(failed)
+                co_yield -1;
+        };
+
+        std::vector<int> v;
+
+        for(int x : caught())
+            v.push_back(x);
+
+        EXPECT_EQ(v, (std::vector<int>{0, 1, -1}));
+    }
+
+
+    TEST(GeneratorTest, Ranges)
+    {
+        std::vector<long> first;
+
+        for(long x : handy::take(fibonacci(), 8))
+            first.push_back(x);
+
+        EXPECT_EQ(first, (std::vector<long>{0, 1, 1, 2, 3, 5, 8, 13}));
+
+
+        std::vector<int> squares;
+
+        for(int x : handy::mapped(handy::filter(iota(0, 10), [](int x){ return x % 3 == 0; }), [](int x){ return x * x; }))
+            squares.push_back(x);
+
+        EXPECT_EQ(squares, (std::vector<int>{0, 9, 36, 81}));
+
+
+        std::vector<int> out(3);
+
+        auto numbers = iota(5, 100);
+
+        for(auto&& [x, o] : handy::zip(numbers, out))
+            o = x;
+
+        EXPECT_EQ(out, (std::vector<int>{5, 6, 7}));
+
+
+        std::vector<int> joined;
+
+        for(int x : handy::concat(iota(0, 3), iota(3, 3), iota(10, 13)))
+            joined.push_back(x);
+
+        EXPECT_EQ(joined, (std::vector<int>{0, 1, 2, 10, 11, 12}));
+    }
+}
+
+#endif // __cpp_impl_coroutine
@@ -0,0 +1,132 @@
+#include <vector>
+#include <string>
+#include <tuple>
+#include <algorithm>
+
+#include "handy/Range/MultiRange.h"
+#include "handy/Range/Parallel.h"
+#include "gtest/gtest.h"
+
+
+namespace
+{
+    template <class Multi>
+    std::vector<std::pair<int, int>> visit (const Multi& m)
+    {
+        std::vector<std::pair<int, int>> res;
+
+        for(auto [i, j] : m)
+            res.emplace_back(i, j);
+
+        return res;
+    }
+
+    /// If each tuple of positions of a rows x cols grid appears exactly once
+    bool coversOnce (std::vector<std::pair<int, int>> v, int rows, int cols)
+    {
+        std::sort(v.begin(), v.end());
+
+        std::vector<std::pair<int, int>> all;
+
+        for(int i = 0; i < rows; ++i)
+            for(int j = 0; j < cols; ++j)
+                all.emplace_back(i, j);
+
+        return v == all;
+    }
+
+
+    TEST(MultiRangeTest, RowMajor)
+    {
+        auto m = handy::mrange(2, 3);
+
+        EXPECT_EQ(m.size(), 6);
+        EXPECT_EQ(visit(m), (std::vector<std::pair<int, int>>{ {0, 0}, {0, 1}, {0, 2}, {1, 0}, {1, 1}, {1, 2} }));
+
+        EXPECT_TRUE((std::is_same<decltype(m)::iterator_category, std::random_access_iterator_tag>::value));
+        EXPECT_EQ(m[4], std::make_tuple(1, 1));
+        EXPECT_EQ(*(m.end() - 1), std::make_tuple(1, 2));
+        EXPECT_EQ(std::distance(m.begin(), m.end()), 6);
+
+
+        std::vector<std::string> names = { "a", "b" };
+
+        auto mixed = handy::mrange(handy::range(1, 7, 2), names, handy::linspace(0.0, 1.0, 3));
+
+        EXPECT_EQ(mixed.size(), 18);
+        EXPECT_EQ(mixed[0], std::make_tuple(1, "a", 0.0));
+        EXPECT_EQ(mixed[17], std::make_tuple(5, "b", 1.0));
+
+        names[1] = "c";
+
+        EXPECT_EQ(std::get<1>(mixed[3]), "c");     // Held by reference
+
+
+        EXPECT_TRUE(handy::mrange(0, 5).empty());
+        EXPECT_TRUE(handy::mrange(0, 5).begin() == handy::mrange(0, 5).end());
+    }
+
+
+    TEST(MultiRangeTest, Tiled)
+    {
+        auto m = handy::mrange(5, 5).tiled(2);
+
+        auto v = visit(m);
+
+        EXPECT_EQ(m.size(), 25);
+        EXPECT_TRUE(coversOnce(v, 5, 5));
+        EXPECT_EQ((std::vector<std::pair<int, int>>(v.begin(), v.begin() + 6)),
+                  (std::vector<std::pair<int, int>>{ {0, 0}, {0, 1}, {1, 0}, {1, 1}, {0, 2}, {0, 3} }));
+
+        EXPECT_TRUE(coversOnce(visit(handy::mrange(7, 10).tiled(3, 4)), 7, 10));
+        EXPECT_EQ(*std::next(m.begin(), 4), std::make_tuple(0, 2));
+
+
+        auto tiles = m.tiles();
+
+        EXPECT_EQ(tiles.size(), 9);
+        EXPECT_EQ(tiles[8].size(), 1);
+        EXPECT_EQ(*tiles[8].begin(), std::make_tuple(4, 4));
+        EXPECT_EQ(visit(tiles[1]), (std::vector<std::pair<int, int>>{ {0, 2}, {0, 3}, {1, 2}, {1, 3} }));
+        EXPECT_EQ(handy::mrange(0, 5).tiled(2).tiles().size(), 0);
+    }
+
+
+    TEST(MultiRangeTest, Morton)
+    {
+        EXPECT_EQ(visit(handy::mrange(4, 4).morton()),
+                  (std::vector<std::pair<int, int>>{ {0, 0}, {0, 1}, {1, 0}, {1, 1}, {0, 2}, {0, 3}, {1, 2}, {1, 3},
+                                                     {2, 0}, {2, 1}, {3, 0}, {3, 1}, {2, 2}, {2, 3}, {3, 2}, {3, 3} }));
+
+        EXPECT_TRUE(coversOnce(visit(handy::mrange(3, 5).morton()), 3, 5));
+        EXPECT_TRUE(coversOnce(visit(handy::mrange(2, 40).morton()), 2, 40));
+        EXPECT_TRUE(coversOnce(visit(handy::mrange(1, 1).morton()), 1, 1));
+
+
+        int count = 0;
+
+        for(auto [i, j, k] : handy::mrange(3, 4, 5).morton())
+            count += (i < 3 && j < 4 && k < 5);
+
+        EXPECT_EQ(count, 60);
+    }
+
+
+    TEST(MultiRangeTest, Parallel)
+    {
+        std::vector<int> hits(100 * 70);
+
+        handy::parallelFor(handy::mrange(100, 70).tiled(16, 32).tiles(), [&](auto tile)
+        {
+            for(auto [i, j] : tile)
+                ++hits[i * 70 + j];
+        });
+
+        EXPECT_TRUE(std::all_of(hits.begin(), hits.end(), [](int h){ return h == 1; }));
+
+
+        handy::parallelFor(handy::mrange(100, 70), [&](auto idx){ ++hits[std::get<0>(idx) * 70 + std::get<1>(idx)]; });
+
+        EXPECT_TRUE(std::all_of(hits.begin(), hits.end(), [](int h){ return h == 2; }));
+    }
+}
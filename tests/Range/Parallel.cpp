@@ -0,0 +1,123 @@
+#include <vector>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+
+#include "handy/Range/Parallel.h"
+#include "gtest/gtest.h"
+
+
+namespace
+{
+    template <class Schedule>
+    void checkSchedule (Schedule s)
+    {
+        std::vector<int> hits(1000);
+
+        handy::parallelFor(handy::range(0, 1000, 3), [&](int i){ ++hits[i]; }, s);
+
+        for(int i = 0; i < 1000; ++i)
+            EXPECT_EQ(hits[i], i % 3 == 0);
+
+
+        long sum = handy::parallelFor(handy::range(1, 101), handy::reduction(0L), [](int i, long& acc){ acc += i; }, s);
+
+        EXPECT_EQ(sum, 5050);
+
+
+        long empty = handy::parallelFor(handy::range(0), handy::reduction(7L), [](int i, long& acc){ acc += i; }, s);
+
+        EXPECT_EQ(empty, 7);
+    }
+
+
+    TEST(ParallelForTest, Schedules)
+    {
+        checkSchedule(handy::schedule::Static{});
+        checkSchedule(handy::schedule::Static{7});
+        checkSchedule(handy::schedule::Dynamic{});
+        checkSchedule(handy::schedule::Dynamic{16});
+        checkSchedule(handy::schedule::Guided{});
+        checkSchedule(handy::schedule::Guided{4});
+    }
+
+
+    TEST(ParallelForTest, Bounds)
+    {
+        auto guided = handy::impl::parallel::bounds(10000, handy::schedule::Guided{10});
+
+        EXPECT_EQ(guided.front(), 0);
+        EXPECT_EQ(guided.back(), 10000);
+
+        // Non increasing blocks, of at least 10 elements, except the last one
+        for(std::size_t k = 1; k + 1 < guided.size(); ++k)
+        {
+            EXPECT_GE(guided[k + 1] - guided[k], k + 2 < guided.size() ? 10 : 1);
+            EXPECT_LE(guided[k + 1] - guided[k], guided[k] - guided[k - 1]);
+        }
+
+        EXPECT_EQ(handy::impl::parallel::bounds(10, handy::schedule::Dynamic{4}), (std::vector<std::size_t>{0, 4, 8, 10}));
+    }
+
+
+    TEST(ParallelForTest, StaticRoundRobin)
+    {
+        std::size_t threads = handy::threadPool().size();
+
+        EXPECT_EQ(handy::impl::parallel::numTasks(100, handy::schedule::Static{7}), std::min<std::size_t>(100, threads));
+        EXPECT_EQ(handy::impl::parallel::numTasks(100, handy::schedule::Dynamic{7}), 100);
+
+        // The blocks k and k + threads are executed by the same thread, in order
+        std::size_t blocks = 20 * threads;
+        std::vector<std::thread::id> ids(blocks);
+        std::vector<int> order(blocks);
+        std::atomic<int> counter{0};
+
+        handy::parallelFor(handy::range(blocks * 5), [&](std::size_t i)
+        {
+            if(i % 5 == 0)
+            {
+                ids[i / 5] = std::this_thread::get_id();
+                order[i / 5] = counter++;
+            }
+        }, handy::schedule::Static{5});
+
+        for(std::size_t k = 0; k + threads < blocks; ++k)
+        {
+            EXPECT_EQ(ids[k], ids[k + threads]);
+            EXPECT_LT(order[k], order[k + threads]);
+        }
+    }
+
+
+    TEST(ParallelForTest, Reduction)
+    {
+        std::vector<double> x(100000);
+
+        std::iota(x.begin(), x.end(), 0.0);
+
+        auto dot = [&](auto s)
+        {
+            return handy::parallelFor(handy::range(x.size()), handy::reduction(0.0), [&](std::size_t i, double& acc)
+            {
+                acc += x[i] * 0.1;
+            }, s);
+        };
+
+        EXPECT_EQ(dot(handy::schedule::Dynamic{100}), dot(handy::schedule::Dynamic{100}));
+        EXPECT_NEAR(dot(handy::schedule::Guided{}), 0.1 * 99999.0 * 100000.0 / 2, 1e-3);
+
+        double maxValue = handy::parallelFor(handy::range(x.size()), handy::reduction(-1.0, [](double a, double b){ return std::max(a, b); }),
+                                             [&](std::size_t i, double& acc){ acc = std::max(acc, x[i]); });
+
+        EXPECT_EQ(maxValue, 99999.0);
+
+        double integral = handy::parallelFor(handy::linspace(0.0, 1.0, 100001), handy::reduction(0.0),
+                                             [](double t, double& acc){ acc += t * t; }, handy::schedule::Static{1000});
+
+        EXPECT_NEAR(integral / 100001, 1.0 / 3, 1e-4);
+
+        EXPECT_THROW(handy::parallelFor(handy::range(100), [](int i){ if(i == 50) throw std::runtime_error("50"); }), std::runtime_error);
+    }
+}
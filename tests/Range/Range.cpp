@@ -1,6 +1,9 @@
 #include <vector>
 #include <algorithm>
 #include <random>
+#include <list>
+#include <string>
+#include <limits>
 
 #include "handy/Range/Range.h"
 #include "gtest/gtest.h"
@@ -88,4 +91,94 @@ namespace
 
         rangeLoopInt<handy::Range<int, handy::impl::ClosedInterval>>(true);
     }
-}
\ No newline at end of file
+
+
+    TEST_F(RangeTest, RandomAccess)
+    {
+        auto r = handy::range(-10, 25, 3);
+
+        EXPECT_TRUE((std::is_same<decltype(r.begin())::iterator_category, std::random_access_iterator_tag>::value));
+
+        EXPECT_EQ(r.size(), 12);
+        EXPECT_EQ(std::distance(r.begin(), r.end()), 12);
+        EXPECT_EQ(r[0], -10);
+        EXPECT_EQ(r[11], 23);
+        EXPECT_EQ(r.begin()[5], 5);
+        EXPECT_EQ(*(r.end() - 1), 23);
+
+        EXPECT_EQ(r.eval(), (std::vector<int>{-10, -7, -4, -1, 2, 5, 8, 11, 14, 17, 20, 23}));
+
+        EXPECT_TRUE(std::binary_search(r.begin(), r.end(), 14));
+        EXPECT_FALSE(std::binary_search(r.begin(), r.end(), 15));
+
+        EXPECT_EQ(handy::range(10, 0, -3).eval(), (std::vector<int>{10, 7, 4, 1}));
+        EXPECT_EQ(handy::crange(10, 0, -5).eval(), (std::vector<int>{10, 5, 0}));
+        EXPECT_EQ(handy::range(5, 5).size(), 0);
+        EXPECT_EQ(handy::range(0, 10, -1).size(), 0);
+        EXPECT_EQ(handy::crange(5, 5).size(), 1);
+
+        EXPECT_EQ(handy::range(0u, 7u, 2u).eval(), (std::vector<unsigned>{0, 2, 4, 6}));
+
+        auto big = handy::range(std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), 1 << 30);
+
+        EXPECT_EQ(big.size(), 4);
+        EXPECT_EQ(big[3], (1 << 30));
+
+
+        auto d = handy::range(0.0, 1.0, 0.25);
+
+        EXPECT_EQ(d.size(), 4);
+        EXPECT_EQ(d[3], 0.75);
+        EXPECT_EQ(handy::crange(0.0, 1.0, 0.25).size(), 5);
+
+
+        std::vector<int> out(12);
+
+        r.eval(out.begin());
+
+        EXPECT_TRUE(std::equal(out.begin(), out.end(), r.begin()));
+
+
+        auto s = handy::range(std::string("a"), std::string("aaaa"), std::string("a"));
+
+        EXPECT_TRUE((std::is_same<decltype(s.begin())::iterator_category, std::forward_iterator_tag>::value));
+    }
+
+
+    TEST_F(RangeTest, FloatingPoint)
+    {
+        EXPECT_EQ(handy::crange(0.0, 1.0, 0.1).size(), 11);
+        EXPECT_EQ(handy::crange(0.0, 0.3, 0.1).size(), 4);
+        EXPECT_EQ(handy::range(0.0, 0.3, 0.1).size(), 3);
+        EXPECT_EQ(handy::crange(0.0f, 1.0f, 0.1f).size(), 11);
+        EXPECT_EQ(handy::range(1.0, 0.0, -0.1).size(), 10);
+        EXPECT_EQ(handy::range(0.0, 1.05, 0.1).size(), 11);
+        EXPECT_EQ(handy::range(0.3, 0.1 + 0.2, 0.1).size(), 0);
+        EXPECT_EQ(handy::crange(0.3, 0.1 + 0.2, 0.1).size(), 1);
+
+        auto r = handy::crange(0.0, 1.0, 0.1);
+
+        EXPECT_EQ(r[7], 7 * 0.1);
+        EXPECT_EQ(std::distance(r.begin(), r.end()), 11);
+
+
+        auto l = handy::linspace(0.0, 1.0, 11);
+
+        EXPECT_TRUE((std::is_same<decltype(l.begin())::iterator_category, std::random_access_iterator_tag>::value));
+        EXPECT_EQ(l.size(), 11);
+        EXPECT_EQ(l[0], 0.0);
+        EXPECT_EQ(l[10], 1.0);
+        EXPECT_DOUBLE_EQ(l[3], 0.3);
+        EXPECT_EQ(*(l.end() - 1), 1.0);
+
+        auto evaluated = l.eval();
+
+        EXPECT_TRUE(std::equal(evaluated.begin(), evaluated.end(), l.begin()));
+        EXPECT_TRUE(std::is_sorted(l.begin(), l.end()));
+
+        EXPECT_EQ(handy::linspace(0, 1, 4, false).eval(), (std::vector<double>{0.0, 0.25, 0.5, 0.75}));
+        EXPECT_EQ(handy::linspace(2.0f, 2.0f, 3).eval(), (std::vector<float>{2.0f, 2.0f, 2.0f}));
+        EXPECT_EQ(handy::linspace(5.0, 7.0, 1).eval(), (std::vector<double>{5.0}));
+        EXPECT_TRUE(handy::linspace(0.0, 1.0, 0).empty());
+    }
+}
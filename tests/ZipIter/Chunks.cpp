@@ -0,0 +1,128 @@
+#include <vector>
+#include <list>
+#include <numeric>
+#include <atomic>
+
+#include "gtest/gtest.h"
+#include "handy/ZipIter/Chunks.h"
+#include "handy/Container/ContainerView.h"
+
+
+namespace
+{
+	TEST(ChunksTest, Container)
+	{
+		std::vector<int> v(23);
+
+		std::iota(v.begin(), v.end(), 0);
+
+		auto cs = handy::chunks(v, 5);
+
+		EXPECT_EQ(cs.size(), 5);
+
+		std::vector<std::size_t> sizes;
+		int next = 0;
+
+		for(auto chunk : cs)
+		{
+			sizes.push_back(chunk.size());
+
+			for(int x : chunk)
+				EXPECT_EQ(x, next++);
+		}
+
+		EXPECT_EQ(next, 23);
+		EXPECT_EQ(sizes, (std::vector<std::size_t>{5, 5, 5, 5, 3}));
+
+		EXPECT_EQ(cs[2][1], 11);
+		EXPECT_EQ((*(cs.begin() + 4)).size(), 3);
+		EXPECT_EQ(cs.end() - cs.begin(), 5);
+
+		EXPECT_EQ(handy::chunks(std::vector<int>{}, 4).size(), 0);
+
+
+		std::list<int> l(v.begin(), v.end());
+
+		next = 0;
+		sizes.clear();
+
+		for(auto chunk : handy::chunks(l, 10))
+		{
+			sizes.push_back(chunk.size());
+
+			for(int x : chunk)
+				EXPECT_EQ(x, next++);
+		}
+
+		EXPECT_EQ(sizes, (std::vector<std::size_t>{10, 10, 3}));
+	}
+
+
+	TEST(ChunksTest, Zip)
+	{
+		handy::Container<float> x(1000), y(1000);
+
+		std::iota(x.begin(), x.end(), 0.0f);
+
+		for(auto chunk : handy::chunks(handy::zip(x, y), 64))
+			for(auto&& [a, b] : chunk)
+				b = 2 * a;
+
+		for(int i = 0; i < 1000; ++i)
+			EXPECT_EQ(y[i], 2 * x[i]);
+
+
+		std::vector<double> z(100000);
+		std::atomic<int> count{0};
+
+		handy::forEach(handy::par, handy::chunks(z, 1000), [&](auto chunk)
+		{
+			for(auto& d : chunk)
+				d = 1.0;
+
+			++count;
+		});
+
+		EXPECT_EQ(count, 100);
+		EXPECT_EQ(std::accumulate(z.begin(), z.end(), 0.0), 100000.0);
+	}
+
+
+	TEST(ChunksTest, Aligned)
+	{
+		std::vector<float> v(1000);
+
+		for(std::size_t shift : {0, 1, 3, 15})
+		{
+			auto cs = handy::alignedChunks(handy::zip(handy::view(v.data() + shift, 900), v), 32);
+
+			std::size_t total = 0;
+
+			for(std::size_t k = 0; k < cs.size(); ++k)
+			{
+				auto chunk = cs[k];
+
+				if(k > 0)
+				{
+					EXPECT_EQ(std::uintptr_t(&std::get<0>(*chunk.begin())) % 64, 0);
+				}
+
+				total += chunk.size();
+			}
+
+			EXPECT_EQ(total, 900);
+		}
+
+		// 24 bytes chunks can not be aligned
+		EXPECT_EQ(handy::alignedChunks(v, 6).bound(1), 6);
+
+
+		// An empty range has no chunks, even if its first chunk would be shortened
+		auto empty = handy::view(v.data() + 1, 0);
+		auto noChunks = handy::alignedChunks(empty, 32);
+
+		EXPECT_EQ(noChunks.size(), 0);
+		EXPECT_TRUE(noChunks.begin() == noChunks.end());
+	}
+
+} // namespace
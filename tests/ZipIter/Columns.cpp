@@ -0,0 +1,135 @@
+#include <vector>
+#include <list>
+#include <deque>
+#include <string>
+#include <memory>
+#include <tuple>
+#include <array>
+
+#include "gtest/gtest.h"
+#include "handy/ZipIter/Columns.h"
+
+
+namespace
+{
+	TEST(ColumnsTest, UnzipInto)
+	{
+		std::vector<std::tuple<int, std::string, double>> rows;
+
+		for(int i = 0; i < 10000; ++i)
+			rows.emplace_back(i, std::string(20, char('a' + i % 26)), 0.5 * i);
+
+		std::vector<int> ids{-1};
+		std::vector<std::string> names;
+		std::deque<double> prices;
+
+		handy::unzipInto(rows, ids, names, prices);
+
+		ASSERT_EQ(ids.size(), 10001);
+		ASSERT_EQ(names.size(), 10000);
+		ASSERT_EQ(prices.size(), 10000);
+
+		EXPECT_EQ(ids[0], -1);
+
+		for(int i = 0; i < 10000; ++i)
+		{
+			EXPECT_EQ(ids[i + 1], i);
+			EXPECT_EQ(names[i], std::get<1>(rows[i]));
+			EXPECT_EQ(prices[i], 0.5 * i);
+		}
+
+
+		names.clear();
+
+		std::array<int, 10000> fixed;
+
+		handy::unzipInto(std::move(rows), fixed, names, prices);
+
+		EXPECT_EQ(fixed[9999], 9999);
+		EXPECT_EQ(names[3], std::string(20, 'd'));
+		EXPECT_TRUE(std::get<1>(rows[3]).empty());
+
+
+		std::list<std::pair<int, std::unique_ptr<int>>> pairs;
+
+		for(int i = 0; i < 5; ++i)
+			pairs.emplace_back(i, std::make_unique<int>(i * i));
+
+		std::vector<int> keys;
+		std::vector<std::unique_ptr<int>> ptrs;
+
+		handy::unzipInto(std::move(pairs), keys, ptrs);
+
+		EXPECT_EQ(keys, (std::vector<int>{0, 1, 2, 3, 4}));
+		EXPECT_EQ(*ptrs[4], 16);
+		EXPECT_EQ(pairs.front().second, nullptr);
+
+
+		// The elements of a zip are references, never moved from
+		std::vector<std::string> a{"x", "y"}, b;
+		std::vector<int> c{1, 2}, d;
+
+		handy::unzipInto(handy::zip(a, c), b, d);
+
+		EXPECT_EQ(a, b);
+		EXPECT_EQ(c, d);
+
+
+		// Bits of the same word are not written from several threads
+		std::vector<std::pair<int, bool>> flagged;
+
+		for(int i = 0; i < 100000; ++i)
+			flagged.emplace_back(i, i % 3 == 0);
+
+		std::vector<int> values;
+		std::vector<bool> flags;
+
+		handy::unzipInto(flagged, values, flags);
+
+		ASSERT_EQ(flags.size(), 100000);
+
+		for(int i = 0; i < 100000; ++i)
+			ASSERT_EQ(flags[i], i % 3 == 0);
+	}
+
+
+	TEST(ColumnsTest, ZipInto)
+	{
+		std::vector<int> ids(10000);
+		std::vector<std::string> names(10000);
+
+		for(int i = 0; i < 10000; ++i)
+			ids[i] = i, names[i] = std::to_string(i);
+
+
+		std::vector<std::tuple<int, std::string>> rows;
+
+		handy::zipInto(rows, ids, names);
+
+		ASSERT_EQ(rows.size(), 10000);
+
+		for(int i = 0; i < 10000; ++i)
+			EXPECT_EQ(rows[i], std::make_tuple(i, std::to_string(i)));
+
+
+		struct Row { int id; std::string name; };
+
+		std::list<Row> list;
+
+		handy::zipInto(list, ids, std::move(names));
+
+		EXPECT_EQ(list.size(), 10000);
+		EXPECT_EQ(list.back().id, 9999);
+		EXPECT_EQ(list.back().name, "9999");
+		EXPECT_TRUE(names[5].empty());
+
+
+		std::pair<int, double> arr[3];
+		std::vector<double> xs{0.5, 1.5, 2.5};
+
+		handy::zipInto(arr, std::vector<int>{1, 2, 3}, xs);
+
+		EXPECT_EQ(arr[2], std::make_pair(3, 2.5));
+	}
+
+} // namespace
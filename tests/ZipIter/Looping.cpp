@@ -5,9 +5,14 @@
 #include <numeric>
 #include <random>
 #include <iostream>
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <sstream>
 
 #include "gtest/gtest.h"
 #include "handy/ZipIter/ZipIter.h"
+#include "handy/Range/Range.h"
 
 
 namespace
@@ -159,5 +164,375 @@ namespace
     // 	EXPECT_EQ(res, sequence);
 	// }
 
-} // namespace
 
+
+	TEST_F(LoopingTest, ParallelForEach)
+	{
+		std::vector<double> x(100003), y(x.size()), z(x.size());
+
+		std::iota(x.begin(), x.end(), 0.0);
+		std::iota(y.begin(), y.end(), 1.0);
+
+		handy::forEach(handy::par, x, y, z, [](double a, double b, double& c){ c = a * b; });
+
+		for(std::size_t i = 0; i < x.size(); ++i)
+			ASSERT_EQ(z[i], x[i] * y[i]);
+
+
+		std::atomic<int> count{0};
+
+		handy::forEach(handy::par(7), v, a, [&](int& p, int q){ p += q; ++count; });
+
+		EXPECT_EQ(count, n);
+
+		for(int i = 0; i < n; ++i)
+			EXPECT_EQ(v[i], sequence[4*i] + a[i]);
+
+
+		EXPECT_THROW(handy::forEach(handy::par(100), x, [](double a){ if(a == 5000) throw std::runtime_error("5000"); }),
+					 std::runtime_error);
+	}
+
+
+
+	TEST_F(LoopingTest, CountedIteration)
+	{
+		std::array<int, 3> arr = {1, 2, 3};
+		std::vector<double> vec = {4, 5, 6};
+
+		auto zipped = handy::zip(arr, vec, a);
+
+		static_assert(std::is_same<decltype(zipped.begin()), handy::CountedZipIter<int*, double*, int*>>::value, "");
+		static_assert(std::is_same<decltype(handy::zip(v, l).begin()),
+								   handy::ZipIter<std::vector<int>::iterator, std::list<int>::iterator>>::value, "");
+
+		EXPECT_EQ(zipped.end() - zipped.begin(), 3);
+
+		for(auto&& [x, y, z] : zipped)
+		{
+			y += x;
+			z = x;
+		}
+
+		EXPECT_EQ(vec, (std::vector<double>{5, 7, 9}));
+		EXPECT_TRUE(std::equal(arr.begin(), arr.end(), a));
+
+		EXPECT_EQ(zipped[1], std::make_tuple(2, 7.0, 2));
+
+		std::get<0>(zipped[2]) = 10;
+
+		EXPECT_EQ(arr[2], 10);
+
+
+		const auto& cv = v;
+
+		std::vector<int> w(v.size());
+
+		for(auto&& [x, y] : handy::zip(cv, w))
+			y = 2 * x;
+
+		for(int i = 0; i < n; ++i)
+			EXPECT_EQ(w[i], 2 * v[i]);
+
+
+		auto zipVW = handy::zip(v, w);
+
+		std::sort(zipVW.begin(), zipVW.end(), std::greater<>());
+
+		EXPECT_TRUE(std::is_sorted(v.rbegin(), v.rend()));
+		EXPECT_TRUE(std::equal(v.begin(), v.end(), w.begin(), [](int x, int y){ return y == 2 * x; }));
+	}
+
+
+
+	TEST_F(LoopingTest, Batched)
+	{
+		std::vector<float> x(37), y(37);
+		std::array<int, 37> z;
+
+		std::iota(x.begin(), x.end(), 0.0f);
+		std::fill(y.begin(), y.end(), 1.0f);
+		std::fill(z.begin(), z.end(), 0);
+
+		auto b = handy::zip(x, y, z).batched<8>();
+
+		EXPECT_EQ(b.size(), 4);
+
+		for(auto [xs, ys, zs] : b)
+		{
+			static_assert(std::is_same<decltype(xs), handy::impl::zip::Span<float, 8>>::value, "");
+
+			for(std::size_t k = 0; k < xs.size(); ++k)
+			{
+				ys[k] += 2 * xs[k];
+				zs[k] = 1;
+			}
+		}
+
+		for(auto&& [x1, y1, z1] : b.tail())
+		{
+			y1 += 2 * x1;
+			z1 = 2;
+		}
+
+		for(int i = 0; i < 37; ++i)
+		{
+			EXPECT_EQ(y[i], 1 + 2 * x[i]);
+			EXPECT_EQ(z[i], i < 32 ? 1 : 2);
+		}
+
+
+		const std::vector<float>& cx = x;
+		std::vector<std::size_t> sizes;
+
+		handy::zip(cx, y).batched<16>().forEach([&](auto xs, auto ys)
+		{
+			static_assert(std::is_const<std::remove_reference_t<decltype(xs[0])>>::value, "");
+
+			for(std::size_t k = 0; k < xs.size(); ++k)
+				ys[k] -= 2 * xs[k];
+
+			sizes.push_back(xs.size());
+		});
+
+		EXPECT_EQ(sizes, (std::vector<std::size_t>{16, 16, 5}));
+		EXPECT_TRUE(std::all_of(y.begin(), y.end(), [](float f){ return f == 1.0f; }));
+
+
+		std::vector<int> e;
+
+		handy::zip(e).batched<4>().forEach([](auto){ FAIL(); });
+	}
+
+
+
+	TEST_F(LoopingTest, Shortest)
+	{
+		std::vector<int> longer(n + 5, 1), shorter(n - 3, 2);
+
+		auto zipped = handy::zipShortest(longer, shorter, a);
+
+		EXPECT_EQ(zipped.size(), n - 3);
+
+		int count = 0;
+
+		for(auto&& [x, y, z] : zipped)
+		{
+			x = y + z;
+			++count;
+		}
+
+		EXPECT_EQ(count, n - 3);
+		EXPECT_EQ(longer[n - 4], 2 + a[n - 4]);
+		EXPECT_EQ(longer[n - 3], 1);
+
+
+		std::list<int> lst(shorter.begin(), shorter.end());
+
+		EXPECT_EQ(std::distance(handy::zipShortest(longer, lst).begin(), handy::zipShortest(longer, lst).end()), n - 3);
+
+		auto zipList = handy::zipShortest(s, lst);
+
+		EXPECT_EQ(zipList.size(), std::min(s.size(), lst.size()));
+
+		count = 0;
+
+		for(auto&& [x, y] : zipList)
+			count += (s.count(x) && y == 2);
+
+		EXPECT_EQ(count, zipList.size());
+
+
+		// The end of a pointer is taken from the length, so going backwards works
+		std::vector<int> rl(l.rbegin(), l.rend()), ra(a, a + n);
+
+		auto zipLA = handy::zip(l, a);
+
+		std::reverse(zipLA.begin(), zipLA.end());
+
+		EXPECT_TRUE(std::equal(l.begin(), l.end(), rl.begin()));
+		EXPECT_TRUE(std::equal(ra.rbegin(), ra.rend(), a));
+	}
+
+
+	TEST_F(LoopingTest, ContainersChange)
+	{
+		std::vector<int> x(4, 1), y(4, 2);
+
+		auto zipped = handy::zip(x, y);
+
+		x.resize(1);
+		y.resize(1);
+		x.shrink_to_fit();
+		y.shrink_to_fit();
+
+		EXPECT_EQ(zipped.size(), 1);
+
+		int count = 0;
+
+		for(auto&& [u, v] : zipped)
+		{
+			u += v;
+			++count;
+		}
+
+		EXPECT_EQ(count, 1);
+		EXPECT_EQ(x[0], 3);
+
+
+		x.resize(6, 0);
+		y.resize(6, 5);
+
+		count = 0;
+
+		for(auto&& [u, v] : zipped)
+			count += (u + v == 5);
+
+		EXPECT_EQ(count, 6);
+		EXPECT_EQ(zipped.size(), 6);
+
+
+		std::list<int> lx(3, 1), ly(3, 2);
+
+		auto zipList = handy::zip(lx, ly);
+
+		lx.pop_back();
+		ly.pop_back();
+
+		EXPECT_EQ(std::distance(zipList.begin(), zipList.end()), 2);
+	}
+
+
+	TEST_F(LoopingTest, Enumerate)
+	{
+		std::vector<double> x(1000), y(1000, 2.0);
+
+		for(auto&& [i, a, b] : handy::enumerate(x, y))
+			a = b * i;
+
+		for(std::size_t i = 0; i < x.size(); ++i)
+			EXPECT_EQ(x[i], 2.0 * i);
+
+
+		auto en = handy::enumerate(v);
+
+		EXPECT_TRUE((std::is_same<decltype(en)::iterator_category, std::random_access_iterator_tag>::value));
+		EXPECT_EQ(en.size(), v.size());
+		EXPECT_EQ(std::get<0>(en[3]), 3);
+		EXPECT_EQ(&std::get<1>(en[3]), &v[3]);
+
+
+		std::size_t count = 0;
+
+		for(auto&& [i, a, b] : handy::enumerate(l, s))
+		{
+			EXPECT_EQ(i, count++);
+			EXPECT_EQ(a, *std::next(l.begin(), i));
+		}
+
+		EXPECT_EQ(count, l.size());
+
+
+		std::vector<int> idx(1000);
+
+		handy::forEach(handy::par(64), handy::enumerate(idx), [](std::size_t i, int& k){ k = int(i); });
+
+		for(int i = 0; i < 1000; ++i)
+			EXPECT_EQ(idx[i], i);
+
+		handy::forEach(handy::enumerate(idx), [](std::size_t i, int& k){ k -= int(i); });
+
+		EXPECT_TRUE(std::all_of(idx.begin(), idx.end(), [](int k){ return k == 0; }));
+	}
+
+
+	TEST_F(LoopingTest, InputIterators)
+	{
+		std::istringstream ints("1 2 3 4 5"), doubles("0.5 1.5 2.5");
+
+		std::vector<double> res;
+
+		handy::forEach(handy::istreamRange<int>(ints), handy::istreamRange<double>(doubles), [&](int x, double y)
+		{
+			res.push_back(x + y);
+		});
+
+		EXPECT_EQ(res, (std::vector<double>{1.5, 3.5, 5.5}));
+
+		// Single pass: the values not zipped are still in the stream, except the one read by the last increment
+		int rest;
+		ints >> rest;
+
+		EXPECT_EQ(rest, 5);
+
+
+		std::istringstream words("a b c d");
+
+		auto zipped = handy::zip(v, handy::istreamRange<std::string>(words));
+
+		EXPECT_TRUE((std::is_same<decltype(zipped)::iterator_category, std::input_iterator_tag>::value));
+
+		std::string cat;
+		std::size_t count = 0;
+
+		for(auto&& [x, w] : zipped)
+		{
+			EXPECT_EQ(x, v[count++]);
+			cat += w;
+		}
+
+		EXPECT_EQ(cat, "abcd");
+		EXPECT_EQ(count, std::min<std::size_t>(v.size(), 4));
+
+
+		std::istringstream line("4 5 6");
+
+		count = 0;
+
+		for(auto&& [w, x] : handy::zipShortest(handy::istreamRange<int>(line), v))
+			EXPECT_EQ(w, 4 + int(count++));
+
+		EXPECT_EQ(count, 3);
+
+
+		// No container has a known size, so the stream ends the iteration
+		std::istringstream few("7 8");
+
+		count = 0;
+
+		for(auto&& [w, x] : handy::zip(handy::istreamRange<int>(few), a))
+		{
+			EXPECT_EQ(w, 7 + int(count));
+			EXPECT_EQ(x, a[count++]);
+		}
+
+		EXPECT_EQ(count, 2);
+
+
+		// The length is taken from the first container with a known size
+		std::istringstream more("1 2 3 4 5 6 7 8 9 10 11 12");
+
+		auto sized = handy::zip(handy::istreamRange<int>(more), a, v);
+
+		EXPECT_EQ(sized.size(), v.size());
+
+		count = 0;
+
+		for(auto&& [w, x, y] : sized)
+			count += (x == a[count] && y == v[count] && w == int(count) + 1);
+
+		EXPECT_EQ(count, std::min<std::size_t>(v.size(), 12));
+	}
+
+
+	TEST_F(LoopingTest, ParallelRange)
+	{
+		std::vector<long> x(5000);
+
+		handy::forEach(handy::par(100), handy::range(0, 10000, 2), x, [](int i, long& a){ a = i; });
+
+		for(int i = 0; i < 5000; ++i)
+			EXPECT_EQ(x[i], 2 * i);
+	}
+
+} // namespace
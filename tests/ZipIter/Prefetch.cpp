@@ -0,0 +1,59 @@
+#include <vector>
+#include <random>
+#include <numeric>
+#include <cstdint>
+
+#include "gtest/gtest.h"
+#include "handy/ZipIter/Prefetch.h"
+
+
+namespace
+{
+	TEST(PrefetchTest, Gather)
+	{
+		std::mt19937 gen(0);
+
+		const int n = 10000;
+
+		std::vector<float> data(n), out(n), expected(n);
+		std::vector<std::uint32_t> idx(n);
+
+		std::iota(data.begin(), data.end(), 0.0f);
+
+		for(auto& i : idx)
+			i = std::uniform_int_distribution<std::uint32_t>(0, n - 1)(gen);
+
+		for(int i = 0; i < n; ++i)
+			expected[i] = data[idx[i]];
+
+
+		auto target = [&](auto&& elem){ return &data[std::get<0>(elem)]; };
+
+		auto prefetched = handy::prefetch<16>(handy::zip(idx, out), target);
+
+		EXPECT_EQ(prefetched.size(), n);
+		EXPECT_EQ(prefetched.end() - prefetched.begin(), n);
+
+		for(auto&& [i, o] : prefetched)
+			o = data[i];
+
+		EXPECT_EQ(out, expected);
+
+
+		std::fill(out.begin(), out.end(), 0.0f);
+
+		auto zipped = handy::zip(idx, out);
+
+		handy::forEach(handy::prefetch<8, 0, 1>(zipped, target), [&](std::uint32_t i, float& o){ o = data[i]; });
+
+		EXPECT_EQ(out, expected);
+
+
+		std::fill(out.begin(), out.end(), 0.0f);
+
+		handy::forEach(handy::par(256), handy::prefetch<1000>(zipped, target), [&](std::uint32_t i, float& o){ o = data[i]; });
+
+		EXPECT_EQ(out, expected);
+	}
+
+} // namespace
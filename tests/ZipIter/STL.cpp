@@ -5,6 +5,8 @@
 #include <numeric>
 #include <random>
 #include <iostream>
+#include <string>
+#include <memory>
 
 #include "gtest/gtest.h"
 #include "handy/ZipIter/ZipIter.h"
@@ -118,6 +120,21 @@ namespace
 			EXPECT_EQ(auxV[i], v[n-i-1]);
 			EXPECT_EQ(auxU[i], u[n-i-1]);
 		}
+
+
+		// The end of a pointer is given by the size of the first container
+		std::vector<int> w(v.begin(), v.begin() + n / 2);
+		int* p = auxV.data();
+
+		std::reverse(ZIP_ALL(w, p));
+
+		for(int i = 0; i < n / 2; ++i)
+		{
+			EXPECT_EQ(w[i], v[n/2-i-1]);
+			EXPECT_EQ(p[i], v[n-1-(n/2-i-1)]);
+		}
+
+		EXPECT_EQ(p[n/2], v[n-1-n/2]);
 	}
 
 
@@ -135,6 +152,126 @@ namespace
 	}
 
 
+	TEST_F(STLTest, SortKeyValue)
+	{
+		std::mt19937 gen(42);
+
+		std::vector<int> keys(1000);
+		std::vector<std::string> vals(keys.size());
+
+		for(std::size_t i = 0; i < keys.size(); ++i)
+		{
+			keys[i] = std::uniform_int_distribution<>(0, 100)(gen);
+			vals[i] = std::to_string(keys[i]) + "_" + std::to_string(i);
+		}
+
+		auto check = [&]
+		{
+			for(std::size_t i = 0; i < keys.size(); ++i)
+				EXPECT_EQ(vals[i].substr(0, vals[i].find('_')), std::to_string(keys[i]));
+		};
+
+
+		auto byKey = handy::unZip([](int k1, const std::string&, int k2, const std::string&){ return k1 < k2; });
+
+		std::sort(ZIP_ALL(keys, vals), byKey);
+
+		EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+		check();
+
+
+		std::shuffle(ZIP_ALL(keys, vals), gen);
+
+		std::vector<int> pos(keys.size());
+
+		std::iota(pos.begin(), pos.end(), 0);
+
+		std::stable_sort(ZIP_ALL(keys, vals, pos), handy::unZip([](int k1, const auto&, int, int k2, const auto&, int)
+		{
+			return k1 < k2;
+		}));
+
+		EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+		check();
+
+		for(std::size_t i = 1; i < keys.size(); ++i)
+			if(keys[i] == keys[i-1])
+			{
+				EXPECT_LT(pos[i-1], pos[i]) << "Not stable";
+			}
+
+
+		std::shuffle(ZIP_ALL(keys, vals), gen);
+
+		auto mid = handy::zipBegin(keys, vals) + 500;
+
+		std::nth_element(handy::zipBegin(keys, vals), mid, handy::zipEnd(keys, vals), byKey);
+
+		EXPECT_TRUE(std::all_of(keys.begin(), keys.begin() + 500, [&](int k){ return k <= keys[500]; }));
+		EXPECT_TRUE(std::all_of(keys.begin() + 500, keys.end(), [&](int k){ return k >= keys[500]; }));
+		check();
+	}
+
+
+	TEST_F(STLTest, ProxyReference)
+	{
+		auto it = handy::zipBegin(v, u);
+
+		static_assert(std::is_same<decltype(*it), handy::impl::zip::Reference<int&, int&>>::value, "");
+		static_assert(std::is_same<decltype(it)::value_type, std::tuple<int, int>>::value, "");
+
+		auto [x, y] = *(it + 3);
+
+		EXPECT_EQ(x, 3);
+		EXPECT_EQ(y, 3);
+
+		x = 20;
+
+		EXPECT_EQ(v[3], 20);
+
+		std::tuple<int, int> val = *it;
+
+		*it = std::make_tuple(7, 8);
+
+		EXPECT_EQ(val, std::make_tuple(0, 0));
+		EXPECT_EQ(v[0], 7);
+		EXPECT_EQ(u[0], 8);
+
+		*it = *(it + 1);
+
+		EXPECT_EQ(v[0], 1);
+		EXPECT_EQ(v[1], 1);
+
+		iter_swap(it, it + 2);
+
+		EXPECT_EQ(v[0], 2);
+		EXPECT_EQ(u[2], 1);
+
+
+		std::vector<std::unique_ptr<int>> ptrs;
+		std::vector<std::string> names = {"c", "a", "b"};
+
+		for(int i : {3, 1, 2})
+			ptrs.push_back(std::make_unique<int>(i));
+
+		auto jt = handy::zipBegin(ptrs, names);
+
+		static_assert(std::is_same<decltype(iter_move(jt)), std::tuple<std::unique_ptr<int>&&, std::string&&>>::value, "");
+
+		std::tuple<std::unique_ptr<int>, std::string> moved = iter_move(jt);
+
+		EXPECT_EQ(*std::get<0>(moved), 3);
+		EXPECT_EQ(std::get<1>(moved), "c");
+		EXPECT_EQ(ptrs[0], nullptr);
+
+		*jt = std::move(moved);
+
+		EXPECT_EQ(*ptrs[0], 3);
+		EXPECT_EQ(names[0], "c");
+		EXPECT_EQ(std::get<1>(moved), "");
+	}
+
+
 	TEST_F(STLTest, ConstIterator)
 	{
 		const std::vector<int>& crefV = v;
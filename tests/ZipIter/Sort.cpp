@@ -0,0 +1,75 @@
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <numeric>
+
+#include "gtest/gtest.h"
+#include "handy/ZipIter/Sort.h"
+
+
+namespace
+{
+	TEST(SortTest, SortBy)
+	{
+		std::mt19937 gen(0);
+
+		const int n = 100000;
+
+		std::vector<int> keys(n), pos(n);
+		std::vector<double> vals(n);
+		std::vector<std::string> names(n);
+
+		for(int i = 0; i < n; ++i)
+		{
+			keys[i] = std::uniform_int_distribution<>(-1000, 1000)(gen);
+			vals[i] = 2.0 * keys[i];
+			names[i] = std::to_string(keys[i]);
+			pos[i] = i;
+		}
+
+		handy::sortBy<0>(handy::zip(keys, vals, names, pos));
+
+		EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+
+		for(int i = 0; i < n; ++i)
+		{
+			EXPECT_EQ(vals[i], 2.0 * keys[i]);
+			EXPECT_EQ(names[i], std::to_string(keys[i]));
+
+			if(i > 0 && keys[i] == keys[i-1])
+			{
+				EXPECT_LT(pos[i-1], pos[i]);
+			}
+		}
+
+
+		handy::sortBy<2>(handy::zip(keys, vals, names), std::greater<>());
+
+		EXPECT_TRUE(std::is_sorted(names.rbegin(), names.rend()));
+
+		for(int i = 0; i < n; ++i)
+			EXPECT_EQ(names[i], std::to_string(keys[i]));
+
+
+		handy::sortBy<1>(handy::zip(keys, vals), std::greater<>());
+
+		EXPECT_TRUE(std::is_sorted(vals.rbegin(), vals.rend()));
+
+		for(int i = 0; i < n; ++i)
+			EXPECT_EQ(vals[i], 2.0 * keys[i]);
+	}
+
+
+	TEST(SortTest, SortByEnumerate)
+	{
+		std::vector<double> x{3.0, 1.0, 2.0, 0.0};
+
+		handy::sortBy<1>(handy::enumerate(x));
+
+		EXPECT_EQ(x, (std::vector<double>{0.0, 1.0, 2.0, 3.0}));
+
+		handy::sortBy<0>(handy::zip(std::vector<int>{}, std::vector<int>{}));
+	}
+
+} // namespace